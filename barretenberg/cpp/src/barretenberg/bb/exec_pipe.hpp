@@ -11,12 +11,16 @@ inline std::vector<uint8_t> exec_pipe(std::string const& command)
         throw std::runtime_error("popen() failed!");
     }
 
-    std::vector<uint8_t> result;
-    while (!feof(pipe)) {
-        uint8_t buffer[128];
-        size_t count = fread(buffer, 1, sizeof(buffer), pipe);
-        result.insert(result.end(), buffer, buffer + count);
+    // Read straight into the result in large chunks, doubling it as needed.
+    std::vector<uint8_t> result(1 << 16);
+    size_t size = 0;
+    while (!feof(pipe) && !ferror(pipe)) {
+        if (size == result.size()) {
+            result.resize(result.size() * 2);
+        }
+        size += fread(result.data() + size, 1, result.size() - size, pipe);
     }
+    result.resize(size);
 
     pclose(pipe);
     return result;
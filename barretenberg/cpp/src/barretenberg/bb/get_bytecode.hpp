@@ -1,11 +1,19 @@
 #pragma once
+#ifdef NO_ZLIB
 #include "exec_pipe.hpp"
+#else
+#include "gzip.hpp"
+#endif
 
 /**
- * We can assume for now we're running on a unix like system and use the following to extract the bytecode.
+ * The bytecode is gzipped. Without zlib, we can assume for now we're running on a unix like system and use gunzip.
  */
 inline std::vector<uint8_t> get_bytecode(const std::string& bytecodePath)
 {
+#ifdef NO_ZLIB
     std::string command = "gunzip -c \"" + bytecodePath + "\"";
     return exec_pipe(command);
-}
\ No newline at end of file
+#else
+    return read_gzip_file(bytecodePath);
+#endif
+}
@@ -38,7 +38,7 @@ inline std::vector<uint8_t> download_g1_data(size_t num_points)
         throw std::runtime_error("Failed to download g1 data.");
     }
 
-    return exec_pipe(command);
+    return data;
 }
 
 inline std::vector<uint8_t> download_g2_data()
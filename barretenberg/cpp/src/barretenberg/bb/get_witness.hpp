@@ -1,12 +1,20 @@
 #pragma once
+#ifdef NO_ZLIB
 #include "exec_pipe.hpp"
+#else
+#include "gzip.hpp"
+#endif
 
 /**
- * We can assume for now we're running on a unix like system and use the following to extract the bytecode.
+ * The witness is gzipped. Without zlib, we can assume for now we're running on a unix like system and use gunzip.
  * Maybe we should consider bytecode being output into its own independent file alongside the JSON?
  */
 inline std::vector<uint8_t> get_witness_data(const std::string& path)
 {
+#ifdef NO_ZLIB
     std::string command = "cat " + path + " | gunzip";
     return exec_pipe(command);
-}
\ No newline at end of file
+#else
+    return read_gzip_file(path);
+#endif
+}
@@ -0,0 +1,95 @@
+#pragma once
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <zlib.h>
+
+/**
+ * @brief The decompressed size a gzip file records in its trailer, which is exact for files of a single member of less
+ * than 4GiB, or 0 if the file is not gzip
+ *
+ * @details The trailer is not checked until the file is inflated, so the size is clamped to the most the file could
+ * inflate to, deflate compressing by at most 1032:1.
+ */
+inline size_t get_gzip_size_hint(const std::string& path)
+{
+    constexpr size_t MAX_DEFLATE_RATIO = 1032;
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        throw std::runtime_error("Unable to open file: " + path);
+    }
+    const auto file_size = static_cast<size_t>(file.tellg());
+    // 10 byte header, an empty deflate stream, and an 8 byte trailer
+    if (file_size < 20) {
+        return 0;
+    }
+    uint8_t magic[2];
+    file.seekg(0, std::ios::beg);
+    file.read(reinterpret_cast<char*>(magic), sizeof(magic));
+    if (magic[0] != 0x1f || magic[1] != 0x8b) {
+        return 0;
+    }
+    uint8_t trailer[4];
+    file.seekg(-4, std::ios::end);
+    file.read(reinterpret_cast<char*>(trailer), sizeof(trailer));
+    const size_t size =
+        size_t(trailer[0]) | (size_t(trailer[1]) << 8) | (size_t(trailer[2]) << 16) | (size_t(trailer[3]) << 24);
+    return std::min(size, file_size * MAX_DEFLATE_RATIO);
+}
+
+/**
+ * @brief Decompresses a gzip file in process
+ *
+ * @details The output is allocated at the size recorded in the file's trailer, up to 256MiB, and the file is inflated
+ * straight into it through a 1MiB read buffer. The output is doubled when the file inflates to more, as files of
+ * several members (whose trailer records the size of the last one), or larger ones, do. A file that is not gzip is read
+ * as is.
+ */
+inline std::vector<uint8_t> read_gzip_file(const std::string& path)
+{
+    constexpr size_t MIN_OUTPUT_SIZE = 1 << 16;
+    constexpr size_t MAX_INITIAL_OUTPUT_SIZE = 1 << 28;
+    std::vector<uint8_t> result(std::clamp(get_gzip_size_hint(path), MIN_OUTPUT_SIZE, MAX_INITIAL_OUTPUT_SIZE));
+
+    gzFile file = gzopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        throw std::runtime_error("Unable to open file: " + path);
+    }
+    gzbuffer(file, 1 << 20);
+
+    auto read = [&](uint8_t* buffer, size_t size) {
+        int count = gzread(file, buffer, static_cast<unsigned>(std::min<size_t>(size, INT_MAX)));
+        if (count < 0) {
+            int error = 0;
+            std::string message = gzerror(file, &error);
+            gzclose(file);
+            throw std::runtime_error("Failed to decompress " + path + ": " + message);
+        }
+        return static_cast<size_t>(count);
+    };
+
+    size_t size = 0;
+    while (true) {
+        if (size == result.size()) {
+            // Only grow the output if the size hint was short, i.e. there is more to read.
+            uint8_t byte = 0;
+            if (read(&byte, 1) == 0) {
+                break;
+            }
+            result.resize(result.size() * 2);
+            result[size++] = byte;
+        }
+        size_t count = read(result.data() + size, result.size() - size);
+        if (count == 0) {
+            break;
+        }
+        size += count;
+    }
+    gzclose(file);
+    result.resize(size);
+    return result;
+}
@@ -0,0 +1,90 @@
+#include "gzip.hpp"
+#include <filesystem>
+#include <gtest/gtest.h>
+
+namespace {
+
+std::vector<uint8_t> make_data(size_t size, uint8_t seed)
+{
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; ++i) {
+        data[i] = static_cast<uint8_t>((i * 31 + seed) % 251);
+    }
+    return data;
+}
+
+void write_bytes(const std::string& path, const std::vector<uint8_t>& bytes, std::ios::openmode mode = {})
+{
+    std::ofstream file(path, std::ios::binary | mode);
+    file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+}
+
+void write_gzip(const std::string& path, const std::vector<uint8_t>& data, const char* mode = "wb")
+{
+    gzFile file = gzopen(path.c_str(), mode);
+    ASSERT_NE(file, nullptr);
+    ASSERT_EQ(gzwrite(file, data.data(), static_cast<unsigned>(data.size())), static_cast<int>(data.size()));
+    gzclose(file);
+}
+
+class ReadGzipFile : public ::testing::Test {
+  protected:
+    void SetUp() override
+    {
+        directory = std::filesystem::temp_directory_path() /
+                    ("read_gzip_file_test_" + std::to_string(reinterpret_cast<uintptr_t>(this)));
+        std::filesystem::create_directories(directory);
+    }
+    void TearDown() override { std::filesystem::remove_all(directory); }
+
+    std::string path(const std::string& name) const { return directory / name; }
+
+    std::filesystem::path directory;
+};
+
+} // namespace
+
+TEST_F(ReadGzipFile, InflatesGzip)
+{
+    // Larger than the smallest output, so that the size hint is used.
+    const auto data = make_data(1 << 20, 1);
+    write_gzip(path("data.gz"), data);
+    EXPECT_EQ(get_gzip_size_hint(path("data.gz")), data.size());
+    EXPECT_EQ(read_gzip_file(path("data.gz")), data);
+}
+
+TEST_F(ReadGzipFile, ReadsOtherFilesAsIs)
+{
+    const auto data = make_data(1000, 2);
+    write_bytes(path("data"), data);
+    EXPECT_EQ(get_gzip_size_hint(path("data")), 0U);
+    EXPECT_EQ(read_gzip_file(path("data")), data);
+}
+
+// The trailer records the size of the last member only, so the output grows past the size hint.
+TEST_F(ReadGzipFile, InflatesEveryMember)
+{
+    const auto first = make_data(1 << 20, 3);
+    const auto second = make_data(100, 4);
+    write_gzip(path("data.gz"), first);
+    write_gzip(path("data.gz"), second, "ab");
+    EXPECT_EQ(get_gzip_size_hint(path("data.gz")), second.size());
+
+    auto expected = first;
+    expected.insert(expected.end(), second.begin(), second.end());
+    EXPECT_EQ(read_gzip_file(path("data.gz")), expected);
+}
+
+TEST_F(ReadGzipFile, ClampsSizeHintToFileSize)
+{
+    write_gzip(path("data.gz"), make_data(100, 5));
+    std::vector<uint8_t> bytes;
+    {
+        std::ifstream file(path("data.gz"), std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    std::fill(bytes.end() - 4, bytes.end(), 0xff);
+    write_bytes(path("data.gz"), bytes);
+    EXPECT_EQ(get_gzip_size_hint(path("data.gz")), bytes.size() * 1032);
+    EXPECT_THROW(read_gzip_file(path("data.gz")), std::runtime_error);
+}
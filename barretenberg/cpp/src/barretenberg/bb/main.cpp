@@ -3,11 +3,18 @@
 #include "get_crs.hpp"
 #include "get_witness.hpp"
 #include "log.hpp"
+#include "serve.hpp"
 #include <barretenberg/common/container.hpp>
 #include <barretenberg/dsl/acir_format/acir_to_constraint_buf.hpp>
 #include <barretenberg/dsl/acir_proofs/acir_composer.hpp>
+#include <barretenberg/ecc/scalar_multiplication/msm_profile.hpp>
 #include <barretenberg/srs/global_crs.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
 #include <iostream>
+#include <map>
+#include <shared_mutex>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -135,17 +142,41 @@ void gateCount(const std::string& bytecodePath)
  * - proc_exit: A boolean value is returned indicating whether the proof is valid.
  *   an exit code of 0 will be returned for success and 1 for failure.
  *
- * @param proof_path Path to the file containing the serialized proof
+ * If proof_path is a directory, every file in it is read as a proof, and all the proofs are verified together with a
+ * single pairing. This is faster than verifying them one by one, but does not say which of them is invalid.
+ *
+ * @param proof_path Path to the file containing the serialized proof, or to a directory of proofs
  * @param recursive Whether to use recursive proof generation of non-recursive
  * @param vk_path Path to the file containing the serialized verification key
- * @return true If the proof is valid
- * @return false If the proof is invalid
+ * @return true If the proof (all of the proofs) is valid
+ * @return false If the proof (any of the proofs) is invalid
  */
 bool verify(const std::string& proof_path, bool recursive, const std::string& vk_path)
 {
     auto acir_composer = init();
     auto vk_data = from_buffer<plonk::verification_key_data>(read_file(vk_path));
     acir_composer.load_verification_key(std::move(vk_data));
+
+    if (std::filesystem::is_directory(proof_path)) {
+        std::vector<std::filesystem::path> paths;
+        for (auto const& entry : std::filesystem::directory_iterator(proof_path)) {
+            if (entry.is_regular_file()) {
+                paths.push_back(entry.path());
+            }
+        }
+        std::sort(paths.begin(), paths.end());
+        std::vector<std::vector<uint8_t>> proofs;
+        proofs.reserve(paths.size());
+        for (auto const& path : paths) {
+            proofs.push_back(read_file(path));
+        }
+        auto verified = acir_composer.verify_proofs(proofs, recursive);
+
+        vinfo("verified ", proofs.size(), " proofs: ", verified);
+
+        return verified;
+    }
+
     auto verified = acir_composer.verify_proof(read_file(proof_path), recursive);
 
     vinfo("verified: ", verified);
@@ -315,6 +346,188 @@ void acvmInfo(const std::string& output_path)
     }
 }
 
+/**
+ * @brief Returns the path of the msm profile for this host
+ *
+ * The BB_MSM_PROFILE environment variable takes precedence, otherwise the profile lives in ~/.bb/msm_profile.
+ */
+std::string getMsmProfilePath()
+{
+    const char* env_path = std::getenv("BB_MSM_PROFILE");
+    if (env_path != nullptr && *env_path != 0) {
+        return env_path;
+    }
+    const char* home = std::getenv("HOME");
+    return (std::filesystem::path(home != nullptr ? home : ".") / ".bb" / "msm_profile").string();
+}
+
+/**
+ * @brief Benchmarks pippenger bucket widths and thread partitions on this host and persists the fastest
+ *
+ * Communication:
+ * - Filesystem: The profile is written to the path specified. Subsequent runs of bb load it on startup.
+ *
+ * @param log_max_msm_size log2 of the largest msm size to tune
+ * @param output_path Path to write the profile to
+ */
+void tune(size_t log_max_msm_size, const std::string& output_path)
+{
+    const size_t max_msm_size = 1ULL << log_max_msm_size;
+    auto g1_data = get_g1_data(CRS_PATH, max_msm_size);
+    auto g2_data = get_g2_data(CRS_PATH);
+    srs::init_crs_factory(g1_data, g2_data);
+    auto prover_crs = srs::get_crs_factory()->get_prover_crs(max_msm_size);
+
+    auto profile = scalar_multiplication::tune_msm_profile<curve::BN254>(prover_crs->get_monomial_points(),
+                                                                         max_msm_size);
+    for (size_t i = 0; i <= scalar_multiplication::msm_profile::MAX_LOG_NUM_POINTS; ++i) {
+        if (profile.bucket_widths[i] != 0) {
+            vinfo("2^", i, " points: bucket width ", profile.bucket_widths[i], ", threads ", profile.num_threads[i]);
+        }
+    }
+
+    std::filesystem::create_directories(std::filesystem::path(output_path).parent_path());
+    scalar_multiplication::write_msm_profile(profile, output_path);
+    scalar_multiplication::set_msm_profile(profile);
+    vinfo("msm profile written to: ", output_path);
+}
+
+/**
+ * @brief The state kept by `bb serve` between requests
+ *
+ * @details The CRS is loaded once, and grown as larger circuits are proven. Requests hold a shared lock on it while they
+ * run, and growing it takes the lock exclusively, waiting for the requests in flight, as it replaces the global CRS
+ * factory. Proving keys are kept by the proving key cache, the size of each circuit proven is kept here so that a
+ * circuit need not be built to know how much of the CRS its proof needs.
+ */
+class Server {
+  public:
+    ServeResponse handle(ServeRequest const& request)
+    {
+        ServeResponse response;
+        response.success = true;
+        acir_proofs::AcirComposer acir_composer(0, verbose);
+
+        if (request.command == "verify") {
+            auto lock = acquire_crs(0);
+            auto vk_data = from_buffer<plonk::verification_key_data>(request.vk);
+            acir_composer.load_verification_key(std::move(vk_data));
+            response.success = acir_composer.verify_proof(request.proof, request.recursive);
+            vinfo("request ", request.id, " verified: ", response.success);
+            return response;
+        }
+
+        auto constraint_system = get_constraint_system(request.bytecode_path);
+        if (request.command == "gates") {
+            acir_composer.create_circuit(constraint_system);
+            uint64_t gate_count = acir_composer.get_total_circuit_size();
+            for (size_t i = 0; i < sizeof(uint64_t); ++i) {
+                response.data.push_back(static_cast<uint8_t>(gate_count >> (8 * i)));
+            }
+            return response;
+        }
+        if (request.command != "prove" && request.command != "write_vk") {
+            throw std::runtime_error("Unknown command: " + request.command);
+        }
+
+        auto hash = acir_proofs::ProvingKeyCache::compute_hash(constraint_system);
+        size_t subgroup_size = get_subgroup_size(hash);
+        if (subgroup_size == 0) {
+            acir_composer.create_circuit(constraint_system);
+            subgroup_size = acir_composer.get_circuit_subgroup_size();
+            set_subgroup_size(hash, subgroup_size);
+        }
+        // Must +1!
+        auto lock = acquire_crs(subgroup_size + 1);
+
+        if (request.command == "prove") {
+            auto witness = get_witness(request.witness_path);
+            response.data = acir_composer.create_proof(constraint_system, witness, request.recursive);
+            vinfo("request ", request.id, " proved");
+        } else {
+            acir_composer.init_proving_key(constraint_system);
+            response.data = to_buffer(*acir_composer.init_verification_key());
+            vinfo("request ", request.id, " wrote vk");
+        }
+        return response;
+    }
+
+  private:
+    /**
+     * @brief Locks a CRS of at least num_points points, loading more of it if needed
+     */
+    std::shared_lock<std::shared_mutex> acquire_crs(size_t num_points)
+    {
+        while (true) {
+            {
+                std::shared_lock lock(crs_mutex_);
+                if (crs_initialised_ && crs_num_points_ >= num_points) {
+                    return lock;
+                }
+            }
+            std::unique_lock lock(crs_mutex_);
+            if (crs_initialised_ && crs_num_points_ >= num_points) {
+                continue;
+            }
+            if (!crs_initialised_) {
+                g2_data_ = get_g2_data(CRS_PATH);
+            }
+            auto g1_data = num_points > 0 ? get_g1_data(CRS_PATH, num_points) : std::vector<g1::affine_element>();
+            srs::init_crs_factory(g1_data, g2_data_);
+            crs_num_points_ = num_points;
+            crs_initialised_ = true;
+            vinfo("loaded crs of ", num_points, " points");
+        }
+    }
+
+    size_t get_subgroup_size(acir_proofs::ProvingKeyCache::Hash const& hash)
+    {
+        std::unique_lock lock(subgroup_sizes_mutex_);
+        auto it = subgroup_sizes_.find(hash);
+        return it != subgroup_sizes_.end() ? it->second : 0;
+    }
+
+    void set_subgroup_size(acir_proofs::ProvingKeyCache::Hash const& hash, size_t subgroup_size)
+    {
+        std::unique_lock lock(subgroup_sizes_mutex_);
+        subgroup_sizes_[hash] = subgroup_size;
+    }
+
+    std::shared_mutex crs_mutex_;
+    bool crs_initialised_ = false;
+    size_t crs_num_points_ = 0;
+    g2::affine_element g2_data_;
+    std::mutex subgroup_sizes_mutex_;
+    std::map<acir_proofs::ProvingKeyCache::Hash, size_t> subgroup_sizes_;
+};
+
+/**
+ * @brief Serves prove, verify, write_vk and gates requests, keeping the CRS and the proving keys in memory between them
+ *
+ * Communication:
+ * - stdin/stdout: Requests are read from stdin and responses written to stdout, unless socket_path is given
+ * - Unix socket: Requests and responses are exchanged over connections to the socket at socket_path
+ *
+ * Each message is its size as a 4 byte big endian integer, followed by a msgpack encoded ServeRequest or ServeResponse.
+ * Up to `concurrency` requests are handled at once, and their responses sent as they complete, identified by the id of
+ * their request.
+ *
+ * @param socket_path Path of the Unix socket to listen on, or empty to use stdin/stdout
+ * @param concurrency The number of requests handled at once
+ */
+void serve(const std::string& socket_path, size_t concurrency)
+{
+    // Requests for the same circuit share its keys.
+    acir_proofs::enable_proving_key_cache();
+    Server server;
+    ServeHandler handler = [&server](ServeRequest const& request) { return server.handle(request); };
+    if (socket_path.empty()) {
+        serve_stdio(handler, concurrency);
+    } else {
+        serve_socket(handler, concurrency, socket_path);
+    }
+}
+
 bool flagPresent(std::vector<std::string>& args, const std::string& flag)
 {
     return std::find(args.begin(), args.end(), flag) != args.end();
@@ -357,6 +570,20 @@ int main(int argc, char* argv[])
             return 0;
         }
 
+        std::string msm_profile_path = getMsmProfilePath();
+        if (command == "tune") {
+            std::string output_path = getOption(args, "-o", msm_profile_path);
+            tune(std::stoul(getOption(args, "-n", "20")), output_path);
+            return 0;
+        }
+        if (scalar_multiplication::load_msm_profile(msm_profile_path)) {
+            vinfo("using msm profile at: ", msm_profile_path);
+        }
+
+        if (command == "serve") {
+            serve(getOption(args, "-s", ""), std::max<size_t>(std::stoul(getOption(args, "-j", "2")), 1));
+            return 0;
+        }
         if (command == "prove_and_verify") {
             return proveAndVerify(bytecode_path, witness_path, recursive) ? 0 : 1;
         }
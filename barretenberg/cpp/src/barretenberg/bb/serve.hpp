@@ -0,0 +1,264 @@
+#pragma once
+#include "log.hpp"
+#include <barretenberg/serialize/cbind.hpp>
+#include <cerrno>
+#include <csignal>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <semaphore>
+#include <stdexcept>
+#include <string>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+/**
+ * A request to `bb serve`. The bytecode and witness are read from files, gzipped as for the other commands, the proof
+ * and verification key of a verify request are sent inline.
+ */
+struct ServeRequest {
+    // Echoed in the response, which may be sent out of order
+    uint64_t id = 0;
+    // One of prove, verify, write_vk, gates
+    std::string command;
+    std::string bytecode_path;
+    std::string witness_path;
+    std::vector<uint8_t> proof;
+    std::vector<uint8_t> vk;
+    bool recursive = false;
+    MSGPACK_FIELDS(id, command, bytecode_path, witness_path, proof, vk, recursive);
+};
+
+/**
+ * The response to a request. data is what the command writes to stdout when run on its own: the proof, the
+ * verification key or the gate count. success is false if the request failed, with the reason in error, or if the proof
+ * of a verify request is invalid.
+ */
+struct ServeResponse {
+    uint64_t id = 0;
+    bool success = false;
+    std::string error;
+    std::vector<uint8_t> data;
+    MSGPACK_FIELDS(id, success, error, data);
+};
+
+using ServeHandler = std::function<ServeResponse(ServeRequest const&)>;
+
+// The largest request read, so that a malformed or hostile size cannot make the server allocate up to 4GiB. Requests
+// carry file paths, and at most a proof and a verification key, inline.
+constexpr size_t MAX_SERVE_MESSAGE_SIZE = 64 << 20;
+
+/**
+ * @brief Reads exactly size bytes from a file descriptor
+ *
+ * @return false if the stream ended before the first byte
+ */
+inline bool read_exact(int fd, uint8_t* buffer, size_t size)
+{
+    size_t offset = 0;
+    while (offset < size) {
+        auto count = ::read(fd, buffer + offset, size - offset);
+        if (count < 0 && errno == EINTR) {
+            continue;
+        }
+        if (count <= 0) {
+            if (offset == 0 && count == 0) {
+                return false;
+            }
+            throw std::runtime_error("Stream ended within a message");
+        }
+        offset += static_cast<size_t>(count);
+    }
+    return true;
+}
+
+inline void write_exact(int fd, const uint8_t* buffer, size_t size)
+{
+    size_t offset = 0;
+    while (offset < size) {
+        auto count = ::write(fd, buffer + offset, size - offset);
+        if (count < 0 && errno == EINTR) {
+            continue;
+        }
+        if (count <= 0) {
+            throw std::runtime_error("Failed to write message: " + std::string(std::strerror(errno)));
+        }
+        offset += static_cast<size_t>(count);
+    }
+}
+
+/**
+ * @brief Reads a message: its size as a 4 byte big endian integer, followed by its msgpack encoding
+ *
+ * @return false if the stream ended
+ * @throws std::runtime_error if the stream ends within the message, or its size exceeds MAX_SERVE_MESSAGE_SIZE
+ */
+template <typename Message> bool read_message(int fd, Message& message)
+{
+    uint8_t size_bytes[4];
+    if (!read_exact(fd, size_bytes, sizeof(size_bytes))) {
+        return false;
+    }
+    size_t size = (size_t(size_bytes[0]) << 24) | (size_t(size_bytes[1]) << 16) | (size_t(size_bytes[2]) << 8) |
+                  size_t(size_bytes[3]);
+    if (size > MAX_SERVE_MESSAGE_SIZE) {
+        throw std::runtime_error("Message of " + std::to_string(size) + " bytes exceeds the limit of " +
+                                 std::to_string(MAX_SERVE_MESSAGE_SIZE));
+    }
+    std::vector<uint8_t> buffer(size);
+    if (size > 0 && !read_exact(fd, buffer.data(), size)) {
+        throw std::runtime_error("Stream ended within a message");
+    }
+    msgpack::unpack((const char*)buffer.data(), buffer.size()).get().convert(message);
+    return true;
+}
+
+/**
+ * @brief Writes a message as read by read_message
+ */
+template <typename Message> void write_message(int fd, Message const& message)
+{
+    msgpack::sbuffer buffer;
+    msgpack::pack(buffer, message);
+    auto size = static_cast<uint32_t>(buffer.size());
+    std::vector<uint8_t> framed{ static_cast<uint8_t>(size >> 24),
+                                 static_cast<uint8_t>(size >> 16),
+                                 static_cast<uint8_t>(size >> 8),
+                                 static_cast<uint8_t>(size) };
+    framed.insert(framed.end(), buffer.data(), buffer.data() + buffer.size());
+    write_exact(fd, framed.data(), framed.size());
+}
+
+/**
+ * @brief A stream of requests and their responses. Closed once every request read from it has been responded to.
+ */
+class ServeConnection {
+  public:
+    ServeConnection(int in_fd, int out_fd, bool owns_fds)
+        : in_fd_(in_fd)
+        , out_fd_(out_fd)
+        , owns_fds_(owns_fds)
+    {}
+    ServeConnection(const ServeConnection&) = delete;
+    ServeConnection& operator=(const ServeConnection&) = delete;
+    ~ServeConnection()
+    {
+        if (owns_fds_) {
+            ::close(in_fd_);
+        }
+    }
+
+    bool read(ServeRequest& request) { return read_message(in_fd_, request); }
+
+    void write(ServeResponse const& response)
+    {
+        std::unique_lock lock(write_mutex_);
+        write_message(out_fd_, response);
+    }
+
+  private:
+    int in_fd_;
+    int out_fd_;
+    bool owns_fds_;
+    std::mutex write_mutex_;
+};
+
+/**
+ * @brief Handles the requests of a connection until it ends, each on its own thread once one of the server's slots is
+ * free. Responses are written as the requests complete.
+ */
+inline void serve_connection(std::shared_ptr<ServeConnection> const& connection,
+                             ServeHandler const& handler,
+                             std::counting_semaphore<>& slots)
+{
+    while (true) {
+        ServeRequest request;
+        try {
+            if (!connection->read(request)) {
+                return;
+            }
+        } catch (std::exception const& err) {
+            info("serve: ", err.what());
+            return;
+        }
+        slots.acquire();
+        std::thread([connection, &handler, &slots, request = std::move(request)]() {
+            ServeResponse response;
+            try {
+                response = handler(request);
+            } catch (std::exception const& err) {
+                response.success = false;
+                response.error = err.what();
+            }
+            response.id = request.id;
+            try {
+                connection->write(response);
+            } catch (std::exception const& err) {
+                info("serve: ", err.what());
+            }
+            slots.release();
+        }).detach();
+    }
+}
+
+/**
+ * @brief Serves requests read from stdin, writing their responses to stdout, until stdin is closed
+ */
+inline void serve_stdio(ServeHandler const& handler, size_t concurrency)
+{
+    std::counting_semaphore<> slots(static_cast<ptrdiff_t>(concurrency));
+    auto connection = std::make_shared<ServeConnection>(STDIN_FILENO, STDOUT_FILENO, false);
+    serve_connection(connection, handler, slots);
+    // Wait for the requests in flight.
+    for (size_t i = 0; i < concurrency; ++i) {
+        slots.acquire();
+    }
+}
+
+/**
+ * @brief Serves the connections made to a Unix socket, until the process is killed
+ *
+ * @details Requests are handled concurrently across connections, with at most `concurrency` in flight in total.
+ */
+inline void serve_socket(ServeHandler const& handler, size_t concurrency, std::string const& socket_path)
+{
+    sockaddr_un address{};
+    if (socket_path.size() >= sizeof(address.sun_path)) {
+        throw std::runtime_error("Socket path is too long: " + socket_path);
+    }
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, socket_path.c_str(), sizeof(address.sun_path) - 1);
+
+    int server_fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (server_fd < 0) {
+        throw std::runtime_error("Failed to create socket: " + std::string(std::strerror(errno)));
+    }
+    std::filesystem::remove(socket_path);
+    if (::bind(server_fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0 || ::listen(server_fd, 16) < 0) {
+        ::close(server_fd);
+        throw std::runtime_error("Failed to listen on " + socket_path + ": " + std::strerror(errno));
+    }
+    // A client closing its connection early must not kill the server when its response is written.
+    std::signal(SIGPIPE, SIG_IGN);
+    vinfo("listening on: ", socket_path);
+
+    std::counting_semaphore<> slots(static_cast<ptrdiff_t>(concurrency));
+    while (true) {
+        int fd = ::accept(server_fd, nullptr, nullptr);
+        if (fd < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            ::close(server_fd);
+            throw std::runtime_error("Failed to accept connection: " + std::string(std::strerror(errno)));
+        }
+        auto connection = std::make_shared<ServeConnection>(fd, fd, true);
+        std::thread([connection, &handler, &slots]() { serve_connection(connection, handler, slots); }).detach();
+    }
+}
@@ -0,0 +1,152 @@
+#include "serve.hpp"
+#include <algorithm>
+#include <array>
+#include <gtest/gtest.h>
+
+// Defined by main.cpp for the bb binary.
+bool verbose = false;
+
+namespace {
+
+struct Pipe {
+    Pipe()
+    {
+        std::array<int, 2> fds{};
+        EXPECT_EQ(::pipe(fds.data()), 0);
+        read_fd = fds[0];
+        write_fd = fds[1];
+    }
+    Pipe(const Pipe&) = delete;
+    Pipe& operator=(const Pipe&) = delete;
+    ~Pipe()
+    {
+        close_read();
+        close_write();
+    }
+
+    void close_read()
+    {
+        if (read_fd >= 0) {
+            ::close(read_fd);
+            read_fd = -1;
+        }
+    }
+
+    void close_write()
+    {
+        if (write_fd >= 0) {
+            ::close(write_fd);
+            write_fd = -1;
+        }
+    }
+
+    int read_fd = -1;
+    int write_fd = -1;
+};
+
+void write_header(int fd, uint32_t size)
+{
+    std::array<uint8_t, 4> header{ static_cast<uint8_t>(size >> 24),
+                                   static_cast<uint8_t>(size >> 16),
+                                   static_cast<uint8_t>(size >> 8),
+                                   static_cast<uint8_t>(size) };
+    write_exact(fd, header.data(), header.size());
+}
+
+} // namespace
+
+TEST(Serve, MessagesRoundTrip)
+{
+    Pipe pipe;
+    ServeRequest request{ 7, "verify", "bytecode", "witness", { 1, 2, 3 }, { 4, 5 }, true };
+    ServeResponse response{ 7, false, "failed", { 6 } };
+    write_message(pipe.write_fd, request);
+    write_message(pipe.write_fd, response);
+    pipe.close_write();
+
+    ServeRequest read_request;
+    ASSERT_TRUE(read_message(pipe.read_fd, read_request));
+    EXPECT_EQ(read_request.id, request.id);
+    EXPECT_EQ(read_request.command, request.command);
+    EXPECT_EQ(read_request.bytecode_path, request.bytecode_path);
+    EXPECT_EQ(read_request.witness_path, request.witness_path);
+    EXPECT_EQ(read_request.proof, request.proof);
+    EXPECT_EQ(read_request.vk, request.vk);
+    EXPECT_EQ(read_request.recursive, request.recursive);
+
+    ServeResponse read_response;
+    ASSERT_TRUE(read_message(pipe.read_fd, read_response));
+    EXPECT_EQ(read_response.id, response.id);
+    EXPECT_EQ(read_response.success, response.success);
+    EXPECT_EQ(read_response.error, response.error);
+    EXPECT_EQ(read_response.data, response.data);
+
+    // The end of the stream between messages is not an error.
+    EXPECT_FALSE(read_message(pipe.read_fd, read_request));
+}
+
+TEST(Serve, RejectsTruncatedMessage)
+{
+    Pipe pipe;
+    write_header(pipe.write_fd, 16);
+    std::array<uint8_t, 3> partial{};
+    write_exact(pipe.write_fd, partial.data(), partial.size());
+    pipe.close_write();
+
+    ServeRequest request;
+    EXPECT_THROW(read_message(pipe.read_fd, request), std::runtime_error);
+}
+
+TEST(Serve, RejectsOversizedMessage)
+{
+    Pipe pipe;
+    write_header(pipe.write_fd, static_cast<uint32_t>(MAX_SERVE_MESSAGE_SIZE + 1));
+    pipe.close_write();
+
+    ServeRequest request;
+    EXPECT_THROW(read_message(pipe.read_fd, request), std::runtime_error);
+}
+
+// A request whose handler throws gets a failed response carrying the error, and a malformed message ends the
+// connection after the requests read before it are responded to.
+TEST(Serve, ConnectionRespondsToFailedRequests)
+{
+    Pipe requests;
+    Pipe responses;
+    write_message(requests.write_fd, ServeRequest{ 1, "fail", "", "", {}, {}, false });
+    write_message(requests.write_fd, ServeRequest{ 2, "gates", "", "", {}, {}, false });
+    write_header(requests.write_fd, static_cast<uint32_t>(MAX_SERVE_MESSAGE_SIZE + 1));
+    requests.close_write();
+
+    ServeHandler handler = [](ServeRequest const& request) {
+        if (request.command == "fail") {
+            throw std::runtime_error("handler failed");
+        }
+        return ServeResponse{ request.id, true, "", { 42 } };
+    };
+    constexpr size_t concurrency = 2;
+    std::counting_semaphore<> slots(static_cast<ptrdiff_t>(concurrency));
+    // The connection closes the read end of the requests once the last request is responded to.
+    auto connection = std::make_shared<ServeConnection>(requests.read_fd, responses.write_fd, true);
+    requests.read_fd = -1;
+    serve_connection(connection, handler, slots);
+    connection.reset();
+    for (size_t i = 0; i < concurrency; ++i) {
+        slots.acquire();
+    }
+    responses.close_write();
+
+    std::vector<ServeResponse> received;
+    ServeResponse response;
+    while (read_message(responses.read_fd, response)) {
+        received.push_back(response);
+    }
+    ASSERT_EQ(received.size(), 2U);
+    std::sort(received.begin(), received.end(), [](auto const& a, auto const& b) { return a.id < b.id; });
+    EXPECT_EQ(received[0].id, 1U);
+    EXPECT_FALSE(received[0].success);
+    EXPECT_EQ(received[0].error, "handler failed");
+    EXPECT_EQ(received[1].id, 2U);
+    EXPECT_TRUE(received[1].success);
+    EXPECT_EQ(received[1].data, std::vector<uint8_t>{ 42 });
+}
@@ -2,6 +2,7 @@
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
+#include "barretenberg/proof_system/circuit_builder/ultra_circuit_builder.hpp"
 #include "barretenberg/srs/factories/file_crs_factory.hpp"
 #include <chrono>
 #include <cstdlib>
@@ -76,6 +77,93 @@ int pippenger()
     return 0;
 }
 
+// Commits to NUM_BATCHED_MSMS polynomials, once with individual pippenger calls and once with a single batched call
+constexpr size_t NUM_BATCHED_MSMS = 4;
+int pippenger_batch()
+{
+    scalar_multiplication::pippenger_runtime_state<curve::BN254> state(NUM_POINTS);
+    std::vector<fr*> batch_scalars;
+    for (size_t i = 0; i < NUM_BATCHED_MSMS; ++i) {
+        batch_scalars.push_back(&scalars[i * NUM_POINTS]);
+    }
+
+    std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
+    for (auto* msm_scalars : batch_scalars) {
+        scalar_multiplication::pippenger_unsafe<curve::BN254>(
+            msm_scalars, reference_string->get_monomial_points(), NUM_POINTS, state);
+    }
+    std::chrono::steady_clock::time_point time_end = std::chrono::steady_clock::now();
+    std::chrono::microseconds diff = std::chrono::duration_cast<std::chrono::microseconds>(time_end - time_start);
+    std::cout << "individual run time: " << diff.count() << "us" << std::endl;
+
+    time_start = std::chrono::steady_clock::now();
+    auto results = scalar_multiplication::pippenger_batch_unsafe<curve::BN254>(
+        batch_scalars, reference_string->get_monomial_points(), NUM_POINTS, state);
+    time_end = std::chrono::steady_clock::now();
+    diff = std::chrono::duration_cast<std::chrono::microseconds>(time_end - time_start);
+    std::cout << "batched run time: " << diff.count() << "us" << std::endl;
+    std::cout << results[0].x << std::endl;
+    return 0;
+}
+
+/**
+ * Commits to the columns of an Ultra circuit, i.e. the Lagrange-basis selector and witness values that Honk commits
+ * to. These are dominated by zero, one and small scalars, which take the sparse path of pippenger. The same number of
+ * MSMs with uniformly random scalars is run for comparison.
+ */
+int pippenger_ultra_columns()
+{
+    using namespace proof_system;
+    UltraCircuitBuilder builder;
+    uint64_t counter = 0;
+    while (builder.get_num_gates() < NUM_POINTS - 1024) {
+        const uint32_t a = builder.add_variable(fr(counter++));
+        const uint32_t b = builder.add_variable(fr::random_element());
+        const uint32_t c = builder.add_variable(builder.get_variable(a) + builder.get_variable(b));
+        builder.create_add_gate({ a, b, c, 1, 1, -1, 0 });
+        builder.decompose_into_default_range(a, 32);
+        const auto accumulators = plookup::get_lookup_accumulators(
+            plookup::MultiTableId::UINT32_XOR, builder.get_variable(a), builder.get_variable(a), true);
+        builder.create_gates_from_plookup_accumulators(plookup::MultiTableId::UINT32_XOR, accumulators, a, a);
+    }
+    builder.finalize_circuit();
+
+    std::vector<std::vector<fr>> columns;
+    for (auto& selector : builder.selectors) {
+        columns.emplace_back(selector.begin(), selector.end());
+    }
+    for (auto& wire : builder.wires) {
+        std::vector<fr> column;
+        for (const uint32_t index : wire) {
+            column.emplace_back(builder.get_variable(index));
+        }
+        columns.emplace_back(std::move(column));
+    }
+
+    scalar_multiplication::pippenger_runtime_state<curve::BN254> state(NUM_POINTS);
+    size_t sparse_time = 0;
+    size_t random_time = 0;
+    for (auto& column : columns) {
+        const size_t num_scalars = std::min(column.size(), NUM_POINTS);
+        std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
+        scalar_multiplication::pippenger_unsafe<curve::BN254>(
+            &column[0], reference_string->get_monomial_points(), num_scalars, state);
+        std::chrono::steady_clock::time_point time_end = std::chrono::steady_clock::now();
+        sparse_time += static_cast<size_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(time_end - time_start).count());
+
+        time_start = std::chrono::steady_clock::now();
+        scalar_multiplication::pippenger_unsafe<curve::BN254>(
+            &scalars[0], reference_string->get_monomial_points(), num_scalars, state);
+        time_end = std::chrono::steady_clock::now();
+        random_time += static_cast<size_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(time_end - time_start).count());
+    }
+    std::cout << "ultra circuit columns: " << columns.size() << " msms, " << sparse_time << "us" << std::endl;
+    std::cout << "random scalars: " << columns.size() << " msms, " << random_time << "us" << std::endl;
+    return 0;
+}
+
 int coset_fft_split()
 {
     std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
@@ -110,5 +198,9 @@ int main()
     pippenger();
     pippenger();
     pippenger();
+    std::cout << "executing batched pippenger algorithm" << std::endl;
+    pippenger_batch();
+    std::cout << "executing pippenger on ultra circuit columns" << std::endl;
+    pippenger_ultra_columns();
     return 0;
 }
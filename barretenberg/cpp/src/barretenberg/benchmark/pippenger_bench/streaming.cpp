@@ -0,0 +1,97 @@
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/scalar_multiplication/mapped_point_table.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/srs/factories/file_crs_factory.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+/**
+ * Compares the peak resident set size and runtime of pippenger over an in-memory point table (`FileProverCrs`) with
+ * `pippenger_streaming` over a memory-mapped point table file. Every variant runs in its own child process, so that
+ * the peak RSS reported by each is its own.
+ *
+ * usage: pippenger_streaming_bench [log2 num points = 20] [chunk size = DEFAULT_STREAMING_CHUNK_SIZE]
+ */
+
+using namespace barretenberg;
+
+const std::string SRS_PATH = "../srs_db/ignition";
+
+std::vector<fr> random_scalars(const size_t num_points)
+{
+    std::vector<fr> scalars(num_points);
+    for (auto& scalar : scalars) {
+        scalar = fr::random_element();
+    }
+    return scalars;
+}
+
+void report(const std::string& name, std::chrono::steady_clock::time_point time_start)
+{
+    std::chrono::steady_clock::time_point time_end = std::chrono::steady_clock::now();
+    std::chrono::microseconds diff = std::chrono::duration_cast<std::chrono::microseconds>(time_end - time_start);
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    std::cout << name << ": run time: " << diff.count() << "us, peak rss: " << usage.ru_maxrss / 1024 << "MB"
+              << std::endl;
+}
+
+int run_in_child(const std::function<void()>& func)
+{
+    const pid_t pid = fork();
+    if (pid == 0) {
+        func();
+        std::exit(0);
+    }
+    int status = 0;
+    waitpid(pid, &status, 0);
+    return WIFEXITED(status) ? WEXITSTATUS(status) : 1;
+}
+
+int main(int argc, char* argv[])
+{
+    const size_t log_num_points = argc > 1 ? std::stoul(argv[1]) : 20;
+    const size_t chunk_size = argc > 2 ? std::stoul(argv[2]) : scalar_multiplication::DEFAULT_STREAMING_CHUNK_SIZE;
+    const size_t num_points = 1UL << log_num_points;
+    const auto table_path = (std::filesystem::temp_directory_path() / "pippenger_streaming_bench.table").string();
+
+    std::cout << "writing point table of " << num_points << " points" << std::endl;
+    int status = run_in_child([&]() {
+        srs::factories::FileProverCrs<curve::BN254> crs(num_points, SRS_PATH);
+        scalar_multiplication::write_point_table<curve::BN254>(table_path, crs.get_monomial_points(), num_points);
+    });
+
+    std::cout << "executing in-memory pippenger" << std::endl;
+    status |= run_in_child([&]() {
+        auto scalars = random_scalars(num_points);
+        auto time_start = std::chrono::steady_clock::now();
+        srs::factories::FileProverCrs<curve::BN254> crs(num_points, SRS_PATH);
+        scalar_multiplication::pippenger_runtime_state<curve::BN254> state(num_points);
+        g1::element result = scalar_multiplication::pippenger_unsafe<curve::BN254>(
+            &scalars[0], crs.get_monomial_points(), num_points, state);
+        report("in-memory (including crs load)", time_start);
+        std::cout << result.x << std::endl;
+    });
+
+    std::cout << "executing streaming pippenger, chunk size " << chunk_size << std::endl;
+    status |= run_in_child([&]() {
+        auto scalars = random_scalars(num_points);
+        auto time_start = std::chrono::steady_clock::now();
+        scalar_multiplication::mapped_point_table<curve::BN254> table(table_path);
+        g1::element result =
+            scalar_multiplication::pippenger_streaming<curve::BN254>(&scalars[0], table, num_points, chunk_size, false);
+        report("streaming (including table map)", time_start);
+        std::cout << result.x << std::endl;
+    });
+
+    std::filesystem::remove(table_path);
+    return status;
+}
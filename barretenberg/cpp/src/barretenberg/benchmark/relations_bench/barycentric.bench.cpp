@@ -24,4 +24,27 @@ void extend_2_to_6(State& state) noexcept
 }
 BENCHMARK(extend_2_to_6);
 
+// As done by the sumcheck prover for each edge of each polynomial
+void extend_edge_2_to_6(State& state) noexcept
+{
+    auto univariate = Univariate<FF, 2>::get_random();
+    Univariate<FF, 6> result;
+    for (auto _ : state) {
+        BarycentricData<FF, 2, 6>::extend_edge(univariate.value_at(0), univariate.value_at(1), result);
+        DoNotOptimize(result);
+    }
+}
+BENCHMARK(extend_edge_2_to_6);
+
+// As done by the sumcheck prover for each subrelation accumulator of each round
+void extend_6_to_7(State& state) noexcept
+{
+    auto univariate = Univariate<FF, 6>::get_random();
+    BarycentricData<FF, 6, 7> barycentric_6_to_7;
+    for (auto _ : state) {
+        DoNotOptimize(barycentric_6_to_7.extend(univariate));
+    }
+}
+BENCHMARK(extend_6_to_7);
+
 } // namespace proof_system::benchmark
\ No newline at end of file
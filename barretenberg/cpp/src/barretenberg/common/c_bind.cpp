@@ -82,7 +82,8 @@ WASM_EXPORT void test_stdout_stderr()
     std::cerr << "c++: hello stderr!";
 }
 
-WASM_EXPORT void common_init_slab_allocator(uint32_t const* circuit_size)
-{
-    barretenberg::init_slab_allocator(ntohl(*circuit_size));
-}
+/**
+ * @brief Kept for the bindings. Memory is no longer pooled process-wide but reserved per proving key (see ProofArena),
+ * so there is nothing to initialise.
+ */
+WASM_EXPORT void common_init_slab_allocator(uint32_t const* /*unused*/) {}
@@ -1,6 +1,19 @@
 #include "./mem.hpp"
 #include "./slab_allocator.hpp"
 #include "./wasm_export.hpp"
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <string>
+
+#if defined(__linux__) && !defined(__wasm__)
+#include <linux/mempolicy.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 WASM_EXPORT void* bbmalloc(size_t size)
 {
@@ -11,3 +24,171 @@ WASM_EXPORT void bbfree(void* ptr)
 {
     barretenberg::free_mem_slab_raw(ptr);
 }
+
+namespace barretenberg {
+
+namespace {
+constexpr size_t BASE_PAGE_SIZE = 1UL << 12;
+
+const char* to_string(HugePages huge_pages)
+{
+    switch (huge_pages) {
+    case HugePages::TRANSPARENT:
+        return "transparent";
+    case HugePages::EXPLICIT:
+        return "explicit";
+    default:
+        return "off";
+    }
+}
+
+MemoryPolicy read_memory_policy_from_env()
+{
+    MemoryPolicy policy;
+    if (const char* huge_pages = std::getenv("BB_HUGE_PAGES"); huge_pages != nullptr) {
+        const std::string value(huge_pages);
+        if (value == "transparent") {
+            policy.huge_pages = HugePages::TRANSPARENT;
+        } else if (value == "explicit") {
+            policy.huge_pages = HugePages::EXPLICIT;
+        } else if (!value.empty() && value != "off") {
+            info("BB_HUGE_PAGES should be one of off, transparent or explicit, ignoring: ", value);
+        }
+    }
+    if (const char* threshold = std::getenv("BB_HUGE_PAGE_THRESHOLD"); threshold != nullptr && *threshold != 0) {
+        policy.huge_page_threshold = std::strtoull(threshold, nullptr, 10);
+    }
+    if (const char* interleave = std::getenv("BB_NUMA_INTERLEAVE"); interleave != nullptr) {
+        policy.numa_interleave = std::string(interleave) == "1";
+    }
+    if (policy.huge_pages != HugePages::OFF || policy.numa_interleave) {
+        info("memory policy: huge pages ",
+             to_string(policy.huge_pages),
+             " for allocations of ",
+             policy.huge_page_threshold,
+             " bytes or more, numa interleave ",
+             policy.numa_interleave ? "on" : "off");
+    }
+    return policy;
+}
+
+MemoryPolicy& active_memory_policy()
+{
+    static MemoryPolicy policy = read_memory_policy_from_env();
+    return policy;
+}
+
+/**
+ * An aligned allocation, or nullptr if there is not enough memory
+ */
+std::shared_ptr<void> try_aligned_alloc(size_t alignment, size_t size)
+{
+#ifdef _WIN32
+    void* ptr = _aligned_malloc(size, alignment);
+#else
+    void* ptr = nullptr;
+    if (posix_memalign(&ptr, alignment, size) != 0) {
+        ptr = nullptr;
+    }
+#endif
+    if (ptr == nullptr) {
+        return nullptr;
+    }
+    return { ptr, aligned_free };
+}
+
+#if defined(__linux__) && !defined(__wasm__)
+std::shared_ptr<void> allocate_transparent_huge_pages(size_t size)
+{
+    auto memory = try_aligned_alloc(HUGE_PAGE_SIZE, size);
+    if (memory != nullptr) {
+        madvise(memory.get(), size, MADV_HUGEPAGE);
+    }
+    return memory;
+}
+
+std::shared_ptr<void> allocate_explicit_huge_pages(size_t size)
+{
+    void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (ptr == MAP_FAILED) {
+        static std::atomic<bool> logged = false;
+        if (!logged.exchange(true)) {
+            info("memory policy: the huge page pool cannot serve ", size, " bytes, using transparent huge pages");
+        }
+        return allocate_transparent_huge_pages(size);
+    }
+    return { ptr, [size](void* p) { munmap(p, size); } };
+}
+
+/**
+ * Interleave the pages of a page aligned allocation across the NUMA nodes the process may use, without touching them.
+ */
+void interleave_numa_nodes(void* ptr, size_t size)
+{
+    std::array<unsigned long, 16> nodes{};
+    constexpr unsigned long max_node = nodes.size() * sizeof(unsigned long) * CHAR_BIT;
+    if (syscall(SYS_get_mempolicy, nullptr, nodes.data(), max_node, nullptr, MPOL_F_MEMS_ALLOWED) != 0 ||
+        syscall(SYS_mbind, ptr, size, MPOL_INTERLEAVE, nodes.data(), max_node, 0) != 0) {
+        static std::atomic<bool> logged = false;
+        if (!logged.exchange(true)) {
+            info("memory policy: cannot interleave allocations across numa nodes: ", std::strerror(errno));
+        }
+    }
+}
+#endif
+} // namespace
+
+const MemoryPolicy& get_memory_policy()
+{
+    return active_memory_policy();
+}
+
+void set_memory_policy(const MemoryPolicy& policy)
+{
+    active_memory_policy() = policy;
+}
+
+std::shared_ptr<void> allocate_with_memory_policy(size_t size)
+{
+    auto memory = try_allocate_with_memory_policy(size);
+    if (memory == nullptr) {
+        info("bad alloc of size: ", size);
+        std::abort();
+    }
+    return memory;
+}
+
+std::shared_ptr<void> try_allocate_with_memory_policy(size_t size)
+{
+    const MemoryPolicy& policy = get_memory_policy();
+    if (size < policy.huge_page_threshold || size == 0) {
+        return try_aligned_alloc(64, size);
+    }
+
+#if defined(__linux__) && !defined(__wasm__)
+    std::shared_ptr<void> memory;
+    const size_t padded_size = pad(size, HUGE_PAGE_SIZE);
+    switch (policy.huge_pages) {
+    case HugePages::TRANSPARENT:
+        memory = allocate_transparent_huge_pages(padded_size);
+        break;
+    case HugePages::EXPLICIT:
+        memory = allocate_explicit_huge_pages(padded_size);
+        break;
+    default:
+        if (!policy.numa_interleave) {
+            return try_aligned_alloc(64, size);
+        }
+        // mbind applies to whole pages
+        memory = try_aligned_alloc(BASE_PAGE_SIZE, pad(size, BASE_PAGE_SIZE));
+    }
+    if (memory != nullptr && policy.numa_interleave) {
+        interleave_numa_nodes(memory.get(), pad(size, BASE_PAGE_SIZE));
+    }
+    return memory;
+#else
+    return try_aligned_alloc(64, size);
+#endif
+}
+
+} // namespace barretenberg
@@ -77,5 +77,53 @@ inline void aligned_free(void* mem)
 //     info("Top-most, releasable space (keepcost): ", minfo.keepcost);
 // }
 
+namespace barretenberg {
+
+constexpr size_t HUGE_PAGE_SIZE = 1UL << 21;
+
+enum class HugePages { OFF, TRANSPARENT, EXPLICIT };
+
+/**
+ * @brief How the large buffers served by get_mem_slab (polynomials, proof arenas, point tables, pippenger scratch space)
+ * are backed.
+ *
+ * @details Allocations of huge_page_threshold bytes or more are aligned and padded to the huge page size, and
+ *  - with HugePages::TRANSPARENT, advised as MADV_HUGEPAGE for the kernel to back them with transparent huge pages;
+ *  - with HugePages::EXPLICIT, mapped with MAP_HUGETLB from the reserved huge page pool, falling back to transparent
+ *    huge pages when the pool cannot serve them.
+ * With numa_interleave their pages are interleaved across the NUMA nodes the process may use (MPOL_INTERLEAVE). The
+ * parallel loops hand out their iterations dynamically, so the node of the thread that will use a page is not known
+ * when it is allocated; interleaving spreads the bandwidth of every large buffer over all nodes rather than placing it
+ * on the node that happens to touch it first. Pages are not touched on allocation.
+ *
+ * The policy is read from the environment on first use: BB_HUGE_PAGES (off, transparent or explicit),
+ * BB_HUGE_PAGE_THRESHOLD (in bytes) and BB_NUMA_INTERLEAVE (0 or 1). It is logged when it is not the default. Only
+ * Linux supports huge pages and interleaving; elsewhere large allocations are plain aligned allocations.
+ */
+struct MemoryPolicy {
+    HugePages huge_pages = HugePages::OFF;
+    size_t huge_page_threshold = HUGE_PAGE_SIZE;
+    bool numa_interleave = false;
+};
+
+const MemoryPolicy& get_memory_policy();
+
+/**
+ * @brief Replace the memory policy. Not thread safe: call this before the allocations it should apply to are made.
+ */
+void set_memory_policy(const MemoryPolicy& policy);
+
+/**
+ * @brief A 64 byte aligned allocation, backed according to the memory policy. Aborts if there is not enough memory.
+ */
+std::shared_ptr<void> allocate_with_memory_policy(size_t size);
+
+/**
+ * @brief As allocate_with_memory_policy, but returns nullptr if there is not enough memory
+ */
+std::shared_ptr<void> try_allocate_with_memory_policy(size_t size);
+
+} // namespace barretenberg
+
 WASM_EXPORT void* bbmalloc(size_t size);
 WASM_EXPORT void bbfree(void* ptr);
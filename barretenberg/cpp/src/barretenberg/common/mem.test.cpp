@@ -0,0 +1,43 @@
+#include "mem.hpp"
+#include <cstdint>
+#include <cstring>
+#include <gtest/gtest.h>
+
+using namespace barretenberg;
+
+namespace {
+void test_large_allocation(HugePages huge_pages)
+{
+    const MemoryPolicy previous_policy = get_memory_policy();
+    set_memory_policy({ .huge_pages = huge_pages, .huge_page_threshold = HUGE_PAGE_SIZE, .numa_interleave = true });
+
+    const size_t size = HUGE_PAGE_SIZE + 100;
+    auto memory = allocate_with_memory_policy(size);
+    auto* bytes = static_cast<uint8_t*>(memory.get());
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(bytes) % 64, 0U);
+    std::memset(bytes, 1, size);
+    EXPECT_EQ(bytes[size - 1], 1);
+
+    // small allocations are not affected by the policy
+    auto small = allocate_with_memory_policy(100);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(small.get()) % 64, 0U);
+
+    set_memory_policy(previous_policy);
+}
+} // namespace
+
+TEST(MemoryPolicy, Off)
+{
+    test_large_allocation(HugePages::OFF);
+}
+
+TEST(MemoryPolicy, TransparentHugePages)
+{
+    test_large_allocation(HugePages::TRANSPARENT);
+}
+
+// Falls back to transparent huge pages where no huge pages are reserved.
+TEST(MemoryPolicy, ExplicitHugePages)
+{
+    test_large_allocation(HugePages::EXPLICIT);
+}
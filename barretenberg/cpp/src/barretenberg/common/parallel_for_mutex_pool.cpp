@@ -10,6 +10,11 @@
 
 namespace {
 
+// Set on the workers, and on a thread for as long as a loop it started runs on the pool. A loop started from within a
+// loop on the pool runs serially on the thread that started it, as the pool can only run one loop at a time.
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local bool in_pool = false;
+
 class ThreadPool {
   public:
     ThreadPool(size_t num_threads);
@@ -98,6 +103,7 @@ ThreadPool::~ThreadPool()
 void ThreadPool::worker_loop(size_t /*unused*/)
 {
     // info("created worker ", worker_num);
+    in_pool = true;
     while (true) {
         {
             std::unique_lock<std::mutex> lock(tasks_mutex);
@@ -116,12 +122,25 @@ void ThreadPool::worker_loop(size_t /*unused*/)
 /**
  * A thread pooled strategy that uses std::mutex for protection. Each worker increments the "iteration" and processes.
  * The main thread acts as a worker also, and when it completes, it spins until thread workers are done.
+ * The pool runs one loop at a time, so loops started by different threads (e.g. concurrent requests to `bb serve`) take
+ * turns, and a loop started from within a loop (e.g. by an allocation in its body) runs serially.
  */
 void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func)
 {
     static ThreadPool pool(get_num_cpus() - 1);
+    static std::mutex pool_mutex;
+
+    if (in_pool) {
+        for (size_t i = 0; i < num_iterations; ++i) {
+            func(i);
+        }
+        return;
+    }
 
     // info("starting job with iterations: ", num_iterations);
+    std::unique_lock<std::mutex> lock(pool_mutex);
+    in_pool = true;
     pool.start_tasks(num_iterations, func);
+    in_pool = false;
     // info("done");
 }
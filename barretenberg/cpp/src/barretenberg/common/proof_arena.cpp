@@ -0,0 +1,176 @@
+#include "proof_arena.hpp"
+#include "mem.hpp"
+#include <algorithm>
+#include <iterator>
+
+namespace {
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local barretenberg::ProofArena* current_arena = nullptr;
+} // namespace
+
+namespace barretenberg {
+
+std::shared_ptr<ProofArena> ProofArena::create(size_t capacity)
+{
+    // The constructor is private, so that arenas are always owned by a shared_ptr the regions can refer to.
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    return std::shared_ptr<ProofArena>(new ProofArena(capacity));
+}
+
+ProofArena::ProofArena(size_t capacity)
+    : capacity(pad(capacity, ALIGNMENT))
+{}
+
+std::shared_ptr<void> ProofArena::allocate(size_t size)
+{
+    // Zero sized requests still get a region of their own, so that no two regions start at the same address.
+    const size_t padded_size = std::max(pad(size, ALIGNMENT), ALIGNMENT);
+    size_t block_index = 0;
+    size_t offset = 0;
+    std::byte* region = nullptr;
+    {
+#ifndef NO_MULTITHREADING
+        std::unique_lock<std::mutex> lock(mutex);
+#endif
+        if (!find_region(padded_size, block_index, offset)) {
+            ++num_heap_allocations;
+        } else {
+            used_size += padded_size;
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            region = static_cast<std::byte*>(blocks[block_index].memory.get()) + offset;
+        }
+    }
+    if (region == nullptr) {
+        return allocate_with_memory_policy(padded_size);
+    }
+    return { region, [arena = shared_from_this(), block_index, offset, padded_size](void* /*unused*/) {
+                arena->release(block_index, offset, padded_size);
+            } };
+}
+
+/**
+ * Find a region of `size` bytes: the smallest free region that fits, or else the top of a block, growing the arena by
+ * a block if none has room.
+ */
+bool ProofArena::find_region(size_t size, size_t& block_index, size_t& offset)
+{
+    auto best_fit = free_regions_by_size.lower_bound({ size, 0, 0 });
+    if (best_fit != free_regions_by_size.end()) {
+        const auto [free_size, free_block_index, free_offset] = *best_fit;
+        free_regions_by_size.erase(best_fit);
+        Block& block = blocks[free_block_index];
+        block.free_regions.erase(free_offset);
+        if (free_size > size) {
+            block.free_regions[free_offset + size] = free_size - size;
+            free_regions_by_size.insert({ free_size - size, free_block_index, free_offset + size });
+        }
+        block_index = free_block_index;
+        offset = free_offset;
+        return true;
+    }
+
+    auto has_room = [size](const Block& block) { return block.size - block.top >= size; };
+    auto block = std::find_if(blocks.begin(), blocks.end(), has_room);
+    if (block == blocks.end()) {
+        if (!add_block(size)) {
+            return false;
+        }
+        block = std::prev(blocks.end());
+    }
+    block_index = static_cast<size_t>(std::distance(blocks.begin(), block));
+    offset = block->top;
+    block->top += size;
+    return true;
+}
+
+bool ProofArena::add_block(size_t min_size)
+{
+    if (capacity - reserved_size < min_size) {
+        return false;
+    }
+    const size_t block_size = std::min(capacity - reserved_size, std::max(min_size, MIN_BLOCK_SIZE));
+    // The pages of the block are only touched when handed out. A block there is no memory for is not an error, the
+    // request falls back to the heap.
+    auto memory = try_allocate_with_memory_policy(block_size);
+    if (memory == nullptr) {
+        return false;
+    }
+    blocks.push_back({ std::move(memory), block_size, 0, {} });
+    reserved_size += block_size;
+    return true;
+}
+
+void ProofArena::release(size_t block_index, size_t offset, size_t size)
+{
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(mutex);
+#endif
+    used_size -= size;
+    Block& block = blocks[block_index];
+
+    // Merge the region with the free regions either side of it.
+    auto next = block.free_regions.lower_bound(offset);
+    if (next != block.free_regions.begin()) {
+        auto previous = std::prev(next);
+        if (previous->first + previous->second == offset) {
+            free_regions_by_size.erase({ previous->second, block_index, previous->first });
+            offset = previous->first;
+            size += previous->second;
+            block.free_regions.erase(previous);
+        }
+    }
+    if (next != block.free_regions.end() && offset + size == next->first) {
+        free_regions_by_size.erase({ next->second, block_index, next->first });
+        size += next->second;
+        block.free_regions.erase(next);
+    }
+
+    if (offset + size == block.top) {
+        block.top = offset;
+    } else {
+        block.free_regions[offset] = size;
+        free_regions_by_size.insert({ size, block_index, offset });
+    }
+}
+
+size_t ProofArena::get_reserved_size() const
+{
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(mutex);
+#endif
+    return reserved_size;
+}
+
+size_t ProofArena::get_used_size() const
+{
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(mutex);
+#endif
+    return used_size;
+}
+
+size_t ProofArena::get_num_heap_allocations() const
+{
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(mutex);
+#endif
+    return num_heap_allocations;
+}
+
+ProofArena* ProofArena::current()
+{
+    return current_arena;
+}
+
+ProofArena::Scope::Scope(ProofArena* arena)
+    : previous(current_arena)
+{
+    current_arena = arena;
+}
+
+ProofArena::Scope::~Scope()
+{
+    current_arena = previous;
+}
+
+} // namespace barretenberg
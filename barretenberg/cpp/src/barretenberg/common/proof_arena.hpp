@@ -0,0 +1,120 @@
+#pragma once
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <set>
+#include <tuple>
+#include <vector>
+#ifndef NO_MULTITHREADING
+#include <mutex>
+#endif
+
+namespace barretenberg {
+
+/**
+ * @brief An allocator serving the memory of the proofs made from one proving key.
+ *
+ * @details The arena grows, as it is used, by blocks of at least MIN_BLOCK_SIZE bytes, up to a capacity set by its
+ * owner to the known polynomial footprint of the proof. Nothing is allocated up front, and a block that cannot be
+ * allocated is not an error. Requests that do not fit, in the capacity or in memory, are served from the heap.
+ *
+ * 64 byte aligned regions are handed out by best fit from the regions freed so far, or else from the top of a block.
+ * Regions are reference counted like any other slab (see get_mem_slab). Freed regions are merged with their free
+ * neighbours, and returned to the top of their block when they reach it. Hence the temporaries of one prover round, or
+ * of one proof, reuse the memory, and the pages, of the previous one, even when some of its polynomials are replaced
+ * before they are freed. The blocks are released when the arena and every region handed out from it are gone.
+ *
+ * Arenas are owned by the proving keys, and made current on a thread with a ProofArena::Scope while a key is built and
+ * while proofs are made from it. get_mem_slab, and with it Polynomial, allocates from the current arena; parallel_for
+ * carries the current arena of the calling thread into its workers. Proofs made concurrently from different keys do not
+ * share any allocator state.
+ */
+class ProofArena : public std::enable_shared_from_this<ProofArena> {
+  public:
+    static constexpr size_t ALIGNMENT = 64;
+    // The smallest block the arena grows by, unless its capacity is smaller
+    static constexpr size_t MIN_BLOCK_SIZE = 1UL << 26;
+
+    /**
+     * @brief Create an arena that grows up to capacity bytes
+     */
+    static std::shared_ptr<ProofArena> create(size_t capacity);
+
+    ProofArena(const ProofArena& other) = delete;
+    ProofArena(ProofArena&& other) = delete;
+    ProofArena& operator=(const ProofArena& other) = delete;
+    ProofArena& operator=(ProofArena&& other) = delete;
+    ~ProofArena() = default;
+
+    /**
+     * @brief Returns a 64 byte aligned region of at least `size` bytes, from the arena when it fits and from the heap
+     * otherwise. The region keeps the arena alive until it is released.
+     */
+    std::shared_ptr<void> allocate(size_t size);
+
+    size_t get_capacity() const { return capacity; }
+
+    /**
+     * @brief The number of bytes of the blocks allocated so far
+     */
+    size_t get_reserved_size() const;
+
+    /**
+     * @brief The number of bytes of the regions handed out from the blocks and not yet released
+     */
+    size_t get_used_size() const;
+
+    /**
+     * @brief The number of requests that did not fit in the arena and were served from the heap
+     */
+    size_t get_num_heap_allocations() const;
+
+    /**
+     * @brief The arena get_mem_slab allocates from on this thread, or nullptr if it uses the heap
+     */
+    static ProofArena* current();
+
+    /**
+     * @brief Makes an arena (or the heap, for nullptr) current on this thread for the lifetime of the scope
+     */
+    class Scope {
+      public:
+        explicit Scope(ProofArena* arena);
+        Scope(const Scope& other) = delete;
+        Scope(Scope&& other) = delete;
+        Scope& operator=(const Scope& other) = delete;
+        Scope& operator=(Scope&& other) = delete;
+        ~Scope();
+
+      private:
+        ProofArena* previous;
+    };
+
+  private:
+    explicit ProofArena(size_t capacity);
+
+    struct Block {
+        std::shared_ptr<void> memory;
+        size_t size;
+        size_t top;
+        // The free regions below the top, by offset
+        std::map<size_t, size_t> free_regions;
+    };
+
+    bool find_region(size_t size, size_t& block_index, size_t& offset);
+    bool add_block(size_t min_size);
+    void release(size_t block_index, size_t offset, size_t size);
+
+    size_t capacity;
+    size_t reserved_size = 0;
+    size_t used_size = 0;
+    size_t num_heap_allocations = 0;
+    std::vector<Block> blocks;
+    // The free regions of every block, by size, block and offset, for best fit
+    std::set<std::tuple<size_t, size_t, size_t>> free_regions_by_size;
+#ifndef NO_MULTITHREADING
+    mutable std::mutex mutex;
+#endif
+};
+
+} // namespace barretenberg
@@ -0,0 +1,149 @@
+#include "proof_arena.hpp"
+#include "mem.hpp"
+#include "slab_allocator.hpp"
+#include "thread.hpp"
+#include <cstdint>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+using namespace barretenberg;
+
+TEST(ProofArena, AllocatesAlignedRegionsAndReusesFreedOnes)
+{
+    auto arena = ProofArena::create(1024);
+    EXPECT_EQ(arena->get_reserved_size(), 0U);
+
+    auto first = arena->allocate(100);
+    auto second = arena->allocate(64);
+    EXPECT_EQ(arena->get_reserved_size(), 1024U);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(first.get()) % ProofArena::ALIGNMENT, 0U);
+    EXPECT_EQ(static_cast<std::byte*>(second.get()) - static_cast<std::byte*>(first.get()), 128);
+    EXPECT_EQ(arena->get_used_size(), 192U);
+
+    // A region freed below a live one is handed out again.
+    void* first_address = first.get();
+    first.reset();
+    EXPECT_EQ(arena->get_used_size(), 64U);
+    auto third = arena->allocate(64);
+    EXPECT_EQ(third.get(), first_address);
+    third.reset();
+    second.reset();
+    EXPECT_EQ(arena->get_used_size(), 0U);
+
+    // Once everything is freed the block is whole again.
+    auto whole = arena->allocate(1024);
+    EXPECT_EQ(whole.get(), first_address);
+    EXPECT_EQ(arena->get_num_heap_allocations(), 0U);
+    whole.reset();
+
+    // Requests that do not fit are served from the heap.
+    auto large = arena->allocate(2048);
+    EXPECT_EQ(arena->get_num_heap_allocations(), 1U);
+    EXPECT_EQ(arena->get_used_size(), 0U);
+}
+
+TEST(ProofArena, GrowsByBlocksUpToItsCapacity)
+{
+    auto arena = ProofArena::create(3 * ProofArena::MIN_BLOCK_SIZE);
+    auto first = arena->allocate(ProofArena::MIN_BLOCK_SIZE / 2);
+    EXPECT_EQ(arena->get_reserved_size(), ProofArena::MIN_BLOCK_SIZE);
+    auto second = arena->allocate(ProofArena::MIN_BLOCK_SIZE);
+    EXPECT_EQ(arena->get_reserved_size(), 2 * ProofArena::MIN_BLOCK_SIZE);
+    auto third = arena->allocate(ProofArena::MIN_BLOCK_SIZE / 2);
+    EXPECT_EQ(arena->get_reserved_size(), 2 * ProofArena::MIN_BLOCK_SIZE);
+    auto fourth = arena->allocate(2 * ProofArena::MIN_BLOCK_SIZE);
+    EXPECT_EQ(arena->get_reserved_size(), 2 * ProofArena::MIN_BLOCK_SIZE);
+    EXPECT_EQ(arena->get_num_heap_allocations(), 1U);
+}
+
+TEST(ProofArena, RegionsOutliveTheirOwner)
+{
+    auto arena = ProofArena::create(1024);
+    auto region = arena->allocate(256);
+    std::weak_ptr<ProofArena> weak_arena = arena;
+    arena.reset();
+    EXPECT_FALSE(weak_arena.expired());
+    region.reset();
+    EXPECT_TRUE(weak_arena.expired());
+}
+
+#ifdef __linux__
+// Whatever the memory policy, the pages of a block are only touched when handed out.
+TEST(ProofArena, ReservationIsNotTouched)
+{
+    const MemoryPolicy previous_policy = get_memory_policy();
+    set_memory_policy({ .huge_pages = HugePages::OFF, .huge_page_threshold = HUGE_PAGE_SIZE, .numa_interleave = true });
+
+    const size_t reserved_size = 64UL << 20;
+    auto arena = ProofArena::create(reserved_size);
+    auto region = arena->allocate(ProofArena::ALIGNMENT);
+
+    const auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const auto block_start = reinterpret_cast<uintptr_t>(region.get()) & ~(page_size - 1);
+    std::vector<unsigned char> resident(reserved_size / page_size + 1);
+    // NOLINTNEXTLINE(performance-no-int-to-ptr)
+    ASSERT_EQ(mincore(reinterpret_cast<void*>(block_start), reserved_size, resident.data()), 0);
+    size_t num_resident = 0;
+    for (const unsigned char page : resident) {
+        num_resident += page & 1;
+    }
+    EXPECT_LT(num_resident, resident.size() / 16);
+
+    set_memory_policy(previous_policy);
+}
+#endif
+
+TEST(ProofArena, ScopesServeMemSlabsOnWorkerThreads)
+{
+    auto arena = ProofArena::create(1 << 20);
+    const size_t num_iterations = 16;
+    std::vector<std::shared_ptr<void>> slabs(num_iterations);
+    {
+        ProofArena::Scope arena_scope(arena.get());
+        parallel_for(num_iterations, [&](size_t i) { slabs[i] = get_mem_slab(1024); });
+    }
+    EXPECT_EQ(ProofArena::current(), nullptr);
+    EXPECT_EQ(arena->get_used_size(), num_iterations * 1024);
+    EXPECT_EQ(arena->get_num_heap_allocations(), 0U);
+    slabs.clear();
+    EXPECT_EQ(arena->get_used_size(), 0U);
+}
+
+TEST(ProofArena, ConcurrentProofsOfDifferentSizesDoNotInterfere)
+{
+    const std::vector<size_t> sizes = { 1 << 10, 1 << 14 };
+    std::vector<std::shared_ptr<ProofArena>> arenas;
+    for (const size_t size : sizes) {
+        arenas.push_back(ProofArena::create(4 * size));
+    }
+
+    std::vector<std::thread> threads;
+    for (size_t j = 0; j < sizes.size(); ++j) {
+        threads.emplace_back([&, j]() {
+            ProofArena::Scope arena_scope(arenas[j].get());
+            for (size_t round = 0; round < 100; ++round) {
+                auto a = get_mem_slab(sizes[j]);
+                auto b = get_mem_slab(2 * sizes[j]);
+                std::memset(a.get(), static_cast<int>(j), sizes[j]);
+                std::memset(b.get(), static_cast<int>(j), 2 * sizes[j]);
+                auto* bytes = static_cast<std::byte*>(a.get());
+                EXPECT_EQ(bytes[sizes[j] - 1], static_cast<std::byte>(j));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (auto& arena : arenas) {
+        EXPECT_EQ(arena->get_used_size(), 0U);
+        EXPECT_EQ(arena->get_num_heap_allocations(), 0U);
+    }
+}
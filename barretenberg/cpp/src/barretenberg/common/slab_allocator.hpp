@@ -5,44 +5,26 @@
 #include <map>
 #include <memory>
 #include <unordered_map>
-#ifndef NO_MULTITHREADING
-#include <mutex>
-#endif
 
 namespace barretenberg {
 
 /**
- * Allocates a bunch of memory slabs sized to serve an UltraPLONK proof construction.
- * If you want normal memory allocator behaviour, just don't call this init function.
- *
- * WARNING: If client code is still holding onto slabs from previous use, when those slabs
- * are released they'll end up back in the allocator. That's probably not desired as presumably
- * those slabs are now too small, so they're effectively leaked. But good client code should be releasing
- * it's resources promptly anyway. It's not considered "proper use" to call init, take slab, and call init
- * again, before releasing the slab.
- *
- * TODO: Take a composer type and allocate slabs according to those requirements?
- * TODO: De-globalise. Init the allocator and pass around. Use a PolynomialFactory (PolynomialStore?).
- * TODO: Consider removing, but once due-dilligence has been done that we no longer have memory limitations.
- */
-void init_slab_allocator(size_t circuit_subgroup_size);
-
-/**
- * Returns a slab from the preallocated pool of slabs, or fallback to a new heap allocation (32 byte aligned).
- * Ref counted result so no need to manually free.
+ * Returns a 64 byte aligned slab from the proof arena current on this thread (see ProofArena), or a new allocation
+ * backed according to the memory policy (see mem.hpp) when there is none. Ref counted result so no need to manually
+ * free.
  */
 std::shared_ptr<void> get_mem_slab(size_t size);
 
 /**
  * Sometimes you want a raw pointer to a slab so you can manage when it's released manually (e.g. c_binds, containers).
- * This still gets a slab with a shared_ptr, but holds the shared_ptr internally until free_mem_slab_raw is called.
+ * These are always heap allocations, as their lifetime is not tied to that of a proof. Release with free_mem_slab_raw.
  */
 void* get_mem_slab_raw(size_t size);
 
 void free_mem_slab_raw(void*);
 
 /**
- * Allocator for containers such as std::vector. Makes them leverage the underlying slab allocator where possible.
+ * Allocator for containers such as std::vector, giving them the 64 byte aligned slabs of get_mem_slab_raw.
  */
 template <typename T> class ContainerSlabAllocator {
   public:
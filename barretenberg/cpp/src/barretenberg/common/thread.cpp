@@ -1,5 +1,6 @@
 #include "thread.hpp"
 #include "log.hpp"
+#include "proof_arena.hpp"
 
 /**
  * There's a lot to talk about here. To bring threading to WASM, parallel_for was written to replace the OpenMP loops
@@ -68,13 +69,10 @@ void parallel_for_atomic_pool(size_t num_iterations, const std::function<void(si
 
 void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func);
 
-void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func)
+#ifndef NO_MULTITHREADING
+namespace {
+void parallel_for_pool(size_t num_iterations, const std::function<void(size_t)>& func)
 {
-#ifdef NO_MULTITHREADING
-    for (size_t i = 0; i < num_iterations; ++i) {
-        func(i);
-    }
-#else
 #ifndef NO_OMP_MULTITHREADING
     parallel_for_omp(num_iterations, func);
 #else
@@ -84,5 +82,26 @@ void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func
     parallel_for_mutex_pool(num_iterations, func);
     // parallel_for_queued(num_iterations, func);
 #endif
+}
+} // namespace
+#endif
+
+void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func)
+{
+#ifdef NO_MULTITHREADING
+    for (size_t i = 0; i < num_iterations; ++i) {
+        func(i);
+    }
+#else
+    // The workers allocate from the proof arena of the calling thread, if it has one.
+    auto* arena = barretenberg::ProofArena::current();
+    if (arena == nullptr) {
+        parallel_for_pool(num_iterations, func);
+        return;
+    }
+    parallel_for_pool(num_iterations, [arena, &func](size_t i) {
+        barretenberg::ProofArena::Scope arena_scope(arena);
+        func(i);
+    });
 #endif
 }
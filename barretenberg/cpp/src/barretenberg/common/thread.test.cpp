@@ -0,0 +1,37 @@
+#include "thread.hpp"
+#include <atomic>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+TEST(ParallelFor, NestedLoopsComplete)
+{
+    constexpr size_t num_outer = 8;
+    constexpr size_t num_inner = 16;
+    std::vector<std::atomic<size_t>> counts(num_outer);
+    parallel_for(num_outer, [&](size_t i) { parallel_for(num_inner, [&](size_t) { counts[i].fetch_add(1); }); });
+    for (auto& count : counts) {
+        EXPECT_EQ(count.load(), num_inner);
+    }
+}
+
+TEST(ParallelFor, ConcurrentCallersComplete)
+{
+    constexpr size_t num_callers = 4;
+    constexpr size_t num_iterations = 1024;
+    std::vector<std::atomic<size_t>> counts(num_callers);
+    std::vector<std::thread> callers;
+    for (size_t caller = 0; caller < num_callers; ++caller) {
+        callers.emplace_back([&, caller]() {
+            for (size_t round = 0; round < 4; ++round) {
+                parallel_for(num_iterations, [&](size_t) { counts[caller].fetch_add(1); });
+            }
+        });
+    }
+    for (auto& caller : callers) {
+        caller.join();
+    }
+    for (auto& count : counts) {
+        EXPECT_EQ(count.load(), 4 * num_iterations);
+    }
+}
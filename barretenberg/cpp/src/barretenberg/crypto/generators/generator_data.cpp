@@ -35,7 +35,6 @@ constexpr size_t size_of_generator_data_array = num_default_generators + num_ind
 constexpr size_t num_generator_types = 3;
 
 ladder_t g1_ladder;
-bool inited = false;
 
 template <size_t ladder_length, size_t ladder_max_length>
 void compute_fixed_base_ladder(const grumpkin::g1::affine_element& generator,
@@ -213,29 +212,28 @@ const fixed_base_ladder* get_ladder_internal(ladder_t const& ladder, const size_
  **/
 std::vector<std::unique_ptr<generator_data>> const& init_generator_data()
 {
-    static std::vector<std::unique_ptr<generator_data>> global_generator_data;
-    if (inited) {
-        return global_generator_data;
-    }
-    std::vector<grumpkin::g1::affine_element> generators;
-    std::vector<grumpkin::g1::affine_element> aux_generators;
-    std::vector<grumpkin::g1::affine_element> skew_generators;
-    std::tie(generators, aux_generators, skew_generators) =
-        derive_generators<size_of_generator_data_array * num_generator_types>();
-
-    global_generator_data.resize(size_of_generator_data_array);
-
-    for (size_t i = 0; i < num_default_generators; i++) {
-        global_generator_data[i] = compute_generator_data(generators[i], aux_generators[i], skew_generators[i]);
-    }
-
-    for (size_t i = num_default_generators; i < size_of_generator_data_array; i++) {
-        global_generator_data[i] = compute_generator_data(generators[i], aux_generators[i], skew_generators[i]);
-    }
+    // Computed once, by the first thread to get here, as circuits may be built concurrently (e.g. by `bb serve`).
+    static const std::vector<std::unique_ptr<generator_data>> global_generator_data = []() {
+        std::vector<std::unique_ptr<generator_data>> generator_data_array;
+        std::vector<grumpkin::g1::affine_element> generators;
+        std::vector<grumpkin::g1::affine_element> aux_generators;
+        std::vector<grumpkin::g1::affine_element> skew_generators;
+        std::tie(generators, aux_generators, skew_generators) =
+            derive_generators<size_of_generator_data_array * num_generator_types>();
+
+        generator_data_array.resize(size_of_generator_data_array);
+
+        for (size_t i = 0; i < num_default_generators; i++) {
+            generator_data_array[i] = compute_generator_data(generators[i], aux_generators[i], skew_generators[i]);
+        }
 
-    compute_fixed_base_ladder<quad_length>(grumpkin::g1::one, g1_ladder);
+        for (size_t i = num_default_generators; i < size_of_generator_data_array; i++) {
+            generator_data_array[i] = compute_generator_data(generators[i], aux_generators[i], skew_generators[i]);
+        }
 
-    inited = true;
+        compute_fixed_base_ladder<quad_length>(grumpkin::g1::one, g1_ladder);
+        return generator_data_array;
+    }();
     return global_generator_data;
 };
 
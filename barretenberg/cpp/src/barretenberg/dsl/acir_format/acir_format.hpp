@@ -69,7 +69,7 @@ struct acir_format {
 
 using WitnessVector = std::vector<fr, ContainerSlabAllocator<fr>>;
 
-void read_witness(Builder& builder, std::vector<barretenberg::fr> const& witness);
+void read_witness(Builder& builder, WitnessVector const& witness);
 
 void create_circuit(Builder& builder, const acir_format& constraint_system);
 
@@ -1,5 +1,6 @@
 #pragma once
 #include "barretenberg/dsl/types.hpp"
+#include "barretenberg/serialize/msgpack.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
 #include <cstdint>
 #include <vector>
@@ -10,6 +11,9 @@ struct MemOp {
     uint8_t access_type;
     poly_triple index;
     poly_triple value;
+
+    // for serialization, update with any new fields
+    MSGPACK_FIELDS(access_type, index, value);
 };
 
 enum BlockType {
@@ -21,6 +25,9 @@ struct BlockConstraint {
     std::vector<poly_triple> init;
     std::vector<MemOp> trace;
     BlockType type;
+
+    // for serialization, update with any new fields
+    MSGPACK_FIELDS(init, trace, type);
 };
 
 void create_block_constraints(Builder& builder,
@@ -61,3 +68,5 @@ template <typename B> inline void write(B& buf, BlockConstraint const& constrain
     write(buf, static_cast<uint8_t>(constraint.type));
 }
 } // namespace acir_format
+
+MSGPACK_ADD_ENUM(acir_format::BlockType);
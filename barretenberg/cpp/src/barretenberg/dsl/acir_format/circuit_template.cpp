@@ -0,0 +1,49 @@
+#include "circuit_template.hpp"
+
+namespace acir_format {
+
+std::shared_ptr<const CircuitTemplate> CircuitTemplate::create(const Builder& builder,
+                                                               const acir_format& constraint_system)
+{
+    // These record values read from the witness, or are only built when the circuit is finalized.
+    if (builder.circuit_finalised || !builder.lookup_tables.empty() || !builder.rom_arrays.empty() ||
+        !builder.ram_arrays.empty() || !builder.cached_partial_non_native_field_multiplications.empty() ||
+        builder.contains_recursive_proof) {
+        return nullptr;
+    }
+
+    std::vector<bool> is_constant(builder.variables.size(), false);
+    for (const auto& [value, index] : builder.constant_variable_indices) {
+        is_constant[index] = true;
+    }
+    // A range list starts with the multiples of the step size up to its target range (see create_range_list), which
+    // are constants as well. The variables range constrained after them are not.
+    for (const auto& [target_range, list] : builder.range_lists) {
+        const size_t num_fixed_values = target_range / Builder::DEFAULT_PLOOKUP_RANGE_STEP_SIZE + 2;
+        for (size_t i = 0; i < num_fixed_values && i < list.variable_indices.size(); ++i) {
+            is_constant[list.variable_indices[i]] = true;
+        }
+    }
+    for (size_t i = constraint_system.varnum; i < builder.variables.size(); ++i) {
+        if (!is_constant[i]) {
+            return nullptr;
+        }
+    }
+
+    // The witnesses are placed by populate, as read_witness placed them on the variables added for them.
+    auto state = Builder::CircuitDataBackup::store_full_state(builder);
+    for (size_t i = 1; i < constraint_system.varnum; ++i) {
+        state.variables[i] = 0;
+    }
+    return std::shared_ptr<const CircuitTemplate>(new CircuitTemplate(std::move(state)));
+}
+
+Builder CircuitTemplate::populate(WitnessVector const& witness) const
+{
+    Builder builder;
+    state_.restore_full_state(builder);
+    read_witness(builder, witness);
+    return builder;
+}
+
+} // namespace acir_format
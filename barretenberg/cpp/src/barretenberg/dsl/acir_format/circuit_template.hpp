@@ -0,0 +1,42 @@
+#pragma once
+#include "acir_format.hpp"
+#include <memory>
+
+namespace acir_format {
+
+/**
+ * @brief The gates, copy constraints and range lists of a circuit, recorded once, that later circuits of the same
+ * constraint system are populated from with only their witnesses.
+ *
+ * @details The circuit is recorded before it is finalized, as finalizing sorts the values of the range lists. It can only
+ * be recorded if each of its variables is either a witness of the constraint system, placed by read_witness, or a
+ * constant. Constraints whose gadgets compute variables from the witness (lookups, ROM/RAM blocks, range constraints
+ * wider than the default plookup range, hashes, signatures, recursion, ...) can only be placed by building the circuit
+ * again. In practice this is the arithmetic constraints, small range constraints and public inputs of a circuit.
+ *
+ * Populating a circuit does not run the native checks of the gadgets, so an invalid witness is only found out by the
+ * proof not verifying.
+ */
+class CircuitTemplate {
+  public:
+    /**
+     * @brief Record the template of a circuit just built from the constraint system, before it is finalized
+     *
+     * @return The template, or nullptr if the circuit has variables computed from the witness
+     */
+    static std::shared_ptr<const CircuitTemplate> create(const Builder& builder, const acir_format& constraint_system);
+
+    /**
+     * @brief The circuit of the constraint system on the given witness
+     */
+    Builder populate(WitnessVector const& witness) const;
+
+  private:
+    explicit CircuitTemplate(Builder::CircuitDataBackup state)
+        : state_(std::move(state))
+    {}
+
+    Builder::CircuitDataBackup state_;
+};
+
+} // namespace acir_format
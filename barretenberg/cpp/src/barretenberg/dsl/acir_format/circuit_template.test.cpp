@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "circuit_template.hpp"
+
+namespace acir_format::tests {
+
+class CircuitTemplateTests : public ::testing::Test {
+  protected:
+    static void SetUpTestSuite() { barretenberg::srs::init_crs_factory("../srs_db/ignition"); }
+
+    // (w1 + w2) * w3 = w4, with w1 public and range constrained to num_bits
+    static acir_format create_constraint_system(uint32_t num_bits)
+    {
+        poly_triple sum{
+            .a = 1,
+            .b = 2,
+            .c = 5,
+            .q_m = 0,
+            .q_l = 1,
+            .q_r = 1,
+            .q_o = -1,
+            .q_c = 0,
+        };
+        poly_triple product{
+            .a = 5,
+            .b = 3,
+            .c = 4,
+            .q_m = 1,
+            .q_l = 0,
+            .q_r = 0,
+            .q_o = -1,
+            .q_c = 0,
+        };
+        RangeConstraint range_constraint{ .witness = 1, .num_bits = num_bits };
+
+        return acir_format{
+            .varnum = 6,
+            .public_inputs = { 1 },
+            .logic_constraints = {},
+            .range_constraints = { range_constraint },
+            .sha256_constraints = {},
+            .schnorr_constraints = {},
+            .ecdsa_k1_constraints = {},
+            .ecdsa_r1_constraints = {},
+            .blake2s_constraints = {},
+            .keccak_constraints = {},
+            .keccak_var_constraints = {},
+            .pedersen_constraints = {},
+            .hash_to_field_constraints = {},
+            .fixed_base_scalar_mul_constraints = {},
+            .recursion_constraints = {},
+            .constraints = { sum, product },
+            .block_constraints = {},
+        };
+    }
+};
+
+TEST_F(CircuitTemplateTests, PopulatedCircuitMatchesBuiltCircuit)
+{
+    auto constraint_system = create_constraint_system(8);
+    auto first_builder = create_circuit_with_witness(constraint_system, { 3, 4, 5, 35, 7 });
+    auto circuit_template = CircuitTemplate::create(first_builder, constraint_system);
+    ASSERT_NE(circuit_template, nullptr);
+
+    WitnessVector witness{ 10, 20, 2, 60, 30 };
+    auto builder = create_circuit_with_witness(constraint_system, witness);
+    auto populated_builder = circuit_template->populate(witness);
+    auto built_state = Builder::CircuitDataBackup::store_full_state(builder);
+    EXPECT_TRUE(built_state.is_same_state(populated_builder));
+
+    auto composer = Composer();
+    auto prover = composer.create_ultra_with_keccak_prover(populated_builder);
+    auto proof = prover.construct_proof();
+    auto verifier = composer.create_ultra_with_keccak_verifier(populated_builder);
+    EXPECT_TRUE(verifier.verify_proof(proof));
+}
+
+// A range constraint wider than the default plookup range decomposes its witness into new variables
+TEST_F(CircuitTemplateTests, VariablesComputedFromWitnessAreNotRecorded)
+{
+    auto constraint_system = create_constraint_system(32);
+    auto builder = create_circuit_with_witness(constraint_system, { 3, 4, 5, 35, 7 });
+    EXPECT_EQ(CircuitTemplate::create(builder, constraint_system), nullptr);
+}
+
+} // namespace acir_format::tests
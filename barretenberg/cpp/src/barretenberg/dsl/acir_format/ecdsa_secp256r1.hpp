@@ -1,5 +1,6 @@
 #pragma once
 #include "barretenberg/dsl/types.hpp"
+#include "barretenberg/serialize/msgpack.hpp"
 #include <vector>
 
 namespace acir_format {
@@ -23,6 +24,8 @@ struct EcdsaSecp256r1Constraint {
     //
     std::vector<uint32_t> signature;
 
+    // for serialization, update with any new fields
+    MSGPACK_FIELDS(hashed_message, pub_x_indices, pub_y_indices, result, signature);
     friend bool operator==(EcdsaSecp256r1Constraint const& lhs, EcdsaSecp256r1Constraint const& rhs) = default;
 };
 
@@ -1,5 +1,6 @@
 #pragma once
 #include "barretenberg/dsl/types.hpp"
+#include "barretenberg/serialize/msgpack.hpp"
 #include <vector>
 
 namespace acir_format {
@@ -12,6 +13,8 @@ struct PedersenConstraint {
     uint32_t result_x;
     uint32_t result_y;
 
+    // for serialization, update with any new fields
+    MSGPACK_FIELDS(scalars, hash_index, result_x, result_y);
     friend bool operator==(PedersenConstraint const& lhs, PedersenConstraint const& rhs) = default;
 };
 
@@ -1,5 +1,6 @@
 #pragma once
 #include "barretenberg/dsl/types.hpp"
+#include "barretenberg/serialize/msgpack.hpp"
 #include "barretenberg/plonk/proof_system/verification_key/verification_key.hpp"
 #include <vector>
 
@@ -57,6 +58,14 @@ struct RecursionConstraint {
     std::array<uint32_t, AGGREGATION_OBJECT_SIZE> output_aggregation_object;
     std::array<uint32_t, AGGREGATION_OBJECT_SIZE> nested_aggregation_object;
 
+    // for serialization, update with any new fields
+    MSGPACK_FIELDS(key,
+                   proof,
+                   public_inputs,
+                   key_hash,
+                   input_aggregation_object,
+                   output_aggregation_object,
+                   nested_aggregation_object);
     friend bool operator==(RecursionConstraint const& lhs, RecursionConstraint const& rhs) = default;
 };
 
@@ -1,5 +1,6 @@
 #pragma once
 #include "barretenberg/dsl/types.hpp"
+#include "barretenberg/serialize/msgpack.hpp"
 #include <vector>
 
 namespace acir_format {
@@ -22,6 +23,8 @@ struct SchnorrConstraint {
     //
     std::vector<uint32_t> signature;
 
+    // for serialization, update with any new fields
+    MSGPACK_FIELDS(message, public_key_x, public_key_y, result, signature);
     friend bool operator==(SchnorrConstraint const& lhs, SchnorrConstraint const& rhs) = default;
 };
 
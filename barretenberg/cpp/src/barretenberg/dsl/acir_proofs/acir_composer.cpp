@@ -11,9 +11,10 @@
 
 namespace acir_proofs {
 
-AcirComposer::AcirComposer(size_t size_hint, bool verbose)
+AcirComposer::AcirComposer(size_t size_hint, bool verbose, ProvingKeyCache& cache)
     : size_hint_(size_hint)
     , verbose_(verbose)
+    , cache_(&cache)
 {}
 
 void AcirComposer::create_circuit(acir_format::acir_format& constraint_system)
@@ -32,19 +33,33 @@ void AcirComposer::create_circuit(acir_format::acir_format& constraint_system)
 
 void AcirComposer::init_proving_key(acir_format::acir_format& constraint_system)
 {
+    if (load_cached_keys(constraint_system)) {
+        return;
+    }
     create_circuit(constraint_system);
     acir_format::Composer composer;
     vinfo("computing proving key...");
     proving_key_ = composer.compute_proving_key(builder_);
+    cache_proving_key();
 }
 
 std::vector<uint8_t> AcirComposer::create_proof(acir_format::acir_format& constraint_system,
                                                 acir_format::WitnessVector& witness,
                                                 bool is_recursive)
 {
-    vinfo("building circuit with witness...");
-    builder_ = acir_format::Builder(size_hint_);
-    create_circuit_with_witness(builder_, constraint_system, witness);
+    if (!proving_key_) {
+        load_cached_keys(constraint_system);
+    }
+
+    if (circuit_template_) {
+        vinfo("populating circuit with witness...");
+        builder_ = circuit_template_->populate(witness);
+    } else {
+        vinfo("building circuit with witness...");
+        builder_ = acir_format::Builder(size_hint_);
+        create_circuit_with_witness(builder_, constraint_system, witness);
+        record_circuit_template(constraint_system);
+    }
     vinfo("gates: ", builder_.get_total_circuit_size());
 
     auto composer = [&]() {
@@ -52,13 +67,19 @@ std::vector<uint8_t> AcirComposer::create_proof(acir_format::acir_format& constr
             return acir_format::Composer(proving_key_, nullptr);
         }
 
+        exact_circuit_size_ = builder_.get_num_gates();
+        total_circuit_size_ = builder_.get_total_circuit_size();
+        circuit_subgroup_size_ = builder_.get_circuit_subgroup_size(total_circuit_size_);
+
         acir_format::Composer composer;
         vinfo("computing proving key...");
         proving_key_ = composer.compute_proving_key(builder_);
         vinfo("done.");
+        cache_proving_key();
         return composer;
     }();
 
+    auto lock = lock_cached_keys();
     vinfo("creating proof...");
     std::vector<uint8_t> proof;
     if (is_recursive) {
@@ -77,10 +98,16 @@ std::shared_ptr<proof_system::plonk::verification_key> AcirComposer::init_verifi
     if (!proving_key_) {
         throw_or_abort("Compute proving key first.");
     }
+    auto lock = lock_cached_keys();
+    if (cached_keys_ && cached_keys_->verification_key) {
+        verification_key_ = cached_keys_->verification_key;
+        return verification_key_;
+    }
     vinfo("computing verification key...");
     acir_format::Composer composer(proving_key_, nullptr);
     verification_key_ = composer.compute_verification_key(builder_);
     vinfo("done.");
+    cache_verification_key();
     return verification_key_;
 }
 
@@ -95,9 +122,11 @@ bool AcirComposer::verify_proof(std::vector<uint8_t> const& proof, bool is_recur
     acir_format::Composer composer(proving_key_, verification_key_);
 
     if (!verification_key_) {
+        auto lock = lock_cached_keys();
         vinfo("computing verification key...");
         verification_key_ = composer.compute_verification_key(builder_);
         vinfo("done.");
+        cache_verification_key();
     }
 
     // Hack. Shouldn't need to do this. 2144 is size with no public inputs.
@@ -112,6 +141,131 @@ bool AcirComposer::verify_proof(std::vector<uint8_t> const& proof, bool is_recur
     }
 }
 
+/**
+ * @brief Verify several proofs of this circuit with a single pairing (see VerifierBase::verify_proofs)
+ *
+ * @return true if every proof is valid
+ */
+bool AcirComposer::verify_proofs(std::vector<std::vector<uint8_t>> const& proofs, bool is_recursive)
+{
+    if (proofs.empty()) {
+        return true;
+    }
+
+    acir_format::Composer composer(proving_key_, verification_key_);
+
+    if (!verification_key_) {
+        auto lock = lock_cached_keys();
+        vinfo("computing verification key...");
+        verification_key_ = composer.compute_verification_key(builder_);
+        vinfo("done.");
+        cache_verification_key();
+    }
+
+    // Proofs of one circuit have the same number of public inputs, and hence the same size.
+    std::vector<plonk::proof> plonk_proofs;
+    plonk_proofs.reserve(proofs.size());
+    for (auto const& proof : proofs) {
+        if (proof.size() != proofs[0].size()) {
+            vinfo("proofs differ in their number of public inputs");
+            return false;
+        }
+        plonk_proofs.push_back({ proof });
+    }
+
+    // Hack. Shouldn't need to do this. 2144 is size with no public inputs.
+    builder_.public_inputs.resize((proofs[0].size() - 2144) / 32);
+
+    if (is_recursive) {
+        auto verifier = composer.create_verifier(builder_);
+        return verifier.verify_proofs(plonk_proofs);
+    } else {
+        auto verifier = composer.create_ultra_with_keccak_verifier(builder_);
+        return verifier.verify_proofs(plonk_proofs);
+    }
+}
+
+/**
+ * @brief Use the keys of the circuit from the proving key cache, if they are there
+ *
+ * @return true if the proving key was found
+ */
+bool AcirComposer::load_cached_keys(acir_format::acir_format& constraint_system)
+{
+    if (!cache_->enabled()) {
+        return false;
+    }
+    circuit_hash_ = ProvingKeyCache::compute_hash(constraint_system);
+    cached_keys_ = cache_->get(circuit_hash_);
+    if (!cached_keys_) {
+        return false;
+    }
+    vinfo("using cached proving key.");
+    exact_circuit_size_ = cached_keys_->exact_circuit_size;
+    total_circuit_size_ = cached_keys_->total_circuit_size;
+    circuit_subgroup_size_ = cached_keys_->circuit_subgroup_size;
+    size_hint_ = circuit_subgroup_size_;
+    proving_key_ = cached_keys_->proving_key;
+    {
+        std::unique_lock lock(cached_keys_->mutex);
+        verification_key_ = cached_keys_->verification_key;
+        circuit_template_ = cached_keys_->circuit_template;
+    }
+    // The verification key, if it is computed from the proving key, takes these from the circuit, which is not built.
+    builder_.contains_recursive_proof = proving_key_->contains_recursive_proof;
+    builder_.recursive_proof_public_input_indices = proving_key_->recursive_proof_public_input_indices;
+    return true;
+}
+
+/**
+ * @brief Add the proving key just computed to the proving key cache, if it is enabled
+ */
+void AcirComposer::cache_proving_key()
+{
+    if (!cache_->enabled()) {
+        return;
+    }
+    cached_keys_ = std::make_shared<ProvingKeyCache::Entry>();
+    cached_keys_->exact_circuit_size = exact_circuit_size_;
+    cached_keys_->total_circuit_size = total_circuit_size_;
+    cached_keys_->circuit_subgroup_size = proving_key_->circuit_size;
+    cached_keys_->proving_key = proving_key_;
+    cached_keys_->circuit_template = circuit_template_;
+    cache_->put(circuit_hash_, cached_keys_);
+}
+
+/**
+ * @brief Add the verification key just computed to the entry of the proving key cache. The entry must be locked.
+ */
+void AcirComposer::cache_verification_key()
+{
+    if (cached_keys_ && !cached_keys_->verification_key) {
+        cache_->set_verification_key(circuit_hash_, *cached_keys_, verification_key_);
+    }
+}
+
+/**
+ * @brief Record the circuit just built with a witness as the template of the circuits of later proofs, if it can be
+ * populated with only a witness (see CircuitTemplate)
+ */
+void AcirComposer::record_circuit_template(acir_format::acir_format& constraint_system)
+{
+    circuit_template_ = acir_format::CircuitTemplate::create(builder_, constraint_system);
+    if (!circuit_template_) {
+        return;
+    }
+    vinfo("recorded circuit template.");
+    if (cached_keys_) {
+        std::unique_lock lock(cached_keys_->mutex);
+        cached_keys_->circuit_template = circuit_template_;
+    }
+}
+
+std::unique_lock<std::mutex> AcirComposer::lock_cached_keys()
+{
+    return cached_keys_ ? std::unique_lock(cached_keys_->mutex) : std::unique_lock<std::mutex>();
+}
+
 std::string AcirComposer::get_solidity_verifier()
 {
     std::ostringstream stream;
@@ -1,16 +1,19 @@
 #pragma once
+#include "proving_key_cache.hpp"
 #include <barretenberg/dsl/acir_format/acir_format.hpp>
+#include <barretenberg/dsl/acir_format/circuit_template.hpp>
 #include <barretenberg/plonk/proof_system/proving_key/proving_key.hpp>
 #include <barretenberg/plonk/proof_system/verification_key/verification_key.hpp>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 
 namespace acir_proofs {
 
 class AcirComposer {
   public:
-    AcirComposer(size_t size_hint = 0, bool verbose = true);
+    AcirComposer(size_t size_hint = 0, bool verbose = true, ProvingKeyCache& cache = get_proving_key_cache());
 
     void create_circuit(acir_format::acir_format& constraint_system);
 
@@ -26,6 +29,8 @@ class AcirComposer {
 
     bool verify_proof(std::vector<uint8_t> const& proof, bool is_recursive);
 
+    bool verify_proofs(std::vector<std::vector<uint8_t>> const& proofs, bool is_recursive);
+
     std::string get_solidity_verifier();
     size_t get_exact_circuit_size() { return exact_circuit_size_; };
     size_t get_total_circuit_size() { return total_circuit_size_; };
@@ -45,6 +50,18 @@ class AcirComposer {
     std::shared_ptr<proof_system::plonk::proving_key> proving_key_;
     std::shared_ptr<proof_system::plonk::verification_key> verification_key_;
     bool verbose_ = true;
+    // The keys shared with other composers of the same circuit through the proving key cache, if it is enabled
+    ProvingKeyCache* cache_;
+    ProvingKeyCache::Hash circuit_hash_{};
+    std::shared_ptr<ProvingKeyCache::Entry> cached_keys_;
+    // Set once a circuit built by create_proof could be recorded, to populate the circuits of later proofs from
+    std::shared_ptr<const acir_format::CircuitTemplate> circuit_template_;
+
+    bool load_cached_keys(acir_format::acir_format& constraint_system);
+    void cache_proving_key();
+    void cache_verification_key();
+    void record_circuit_template(acir_format::acir_format& constraint_system);
+    std::unique_lock<std::mutex> lock_cached_keys();
 
     template <typename... Args> inline void vinfo(Args... args)
     {
@@ -0,0 +1,216 @@
+#include "proving_key_cache.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/serialize.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include "barretenberg/plonk/proof_system/proving_key/serialize.hpp"
+#include "barretenberg/serialize/cbind.hpp"
+#include "barretenberg/srs/global_crs.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+namespace acir_proofs {
+
+namespace {
+bool file_exists(const std::string& path)
+{
+    return std::ifstream(path).good();
+}
+
+std::vector<uint8_t> read_bytes(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+}
+
+/**
+ * Write a file under a temporary name and rename it into place, so that other processes see either all of it or none.
+ */
+template <typename WriteFn> void write_atomically(const std::string& path, WriteFn write_fn)
+{
+    const std::string temporary_path =
+        path + "." + std::to_string(numeric::random::get_engine().get_random_uint64()) + ".tmp";
+    write_fn(temporary_path);
+    if (std::rename(temporary_path.c_str(), path.c_str()) != 0) {
+        std::remove(temporary_path.c_str());
+        throw_or_abort("Failed to write: " + path);
+    }
+}
+
+void write_bytes(const std::string& path, const std::vector<uint8_t>& bytes)
+{
+    write_atomically(path, [&](const std::string& temporary_path) {
+        std::ofstream file(temporary_path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        if (!file.good()) {
+            throw_or_abort("Failed to write: " + temporary_path);
+        }
+    });
+}
+
+const char* get_capacity_from_env()
+{
+    const char* size = std::getenv("BB_PROVING_KEY_CACHE_SIZE");
+    return size != nullptr && *size != 0 ? size : nullptr;
+}
+
+ProvingKeyCache create_from_env()
+{
+    // Keys are large, and kept alive by the cache, so it is off unless asked for.
+    size_t capacity = 0;
+    if (const char* size = get_capacity_from_env(); size != nullptr) {
+        capacity = std::strtoull(size, nullptr, 10);
+    }
+    std::string directory;
+    if (const char* dir = std::getenv("BB_PROVING_KEY_CACHE_DIR"); dir != nullptr) {
+        directory = dir;
+        info("proving key cache: ", capacity, " circuits in memory, directory ", directory);
+    }
+    return ProvingKeyCache(capacity, directory);
+}
+} // namespace
+
+ProvingKeyCache::ProvingKeyCache(size_t capacity, std::string directory)
+    : capacity_(capacity)
+    , directory_(std::move(directory))
+{}
+
+ProvingKeyCache::Hash ProvingKeyCache::compute_hash(const acir_format::acir_format& constraint_system)
+{
+    msgpack::sbuffer buffer;
+    msgpack::pack(buffer, constraint_system);
+    return sha256::sha256(std::vector<uint8_t>(buffer.data(), buffer.data() + buffer.size()));
+}
+
+std::shared_ptr<ProvingKeyCache::Entry> ProvingKeyCache::get(const Hash& hash)
+{
+    {
+        std::unique_lock lock(mutex_);
+        for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+            if (it->first == hash) {
+                entries_.splice(entries_.begin(), entries_, it);
+                return entries_.front().second;
+            }
+        }
+    }
+    auto entry = read_from_directory(hash);
+    if (entry) {
+        insert(hash, entry);
+    }
+    return entry;
+}
+
+void ProvingKeyCache::put(const Hash& hash, std::shared_ptr<Entry> entry)
+{
+    if (!directory_.empty()) {
+        write_to_directory(hash, *entry);
+    }
+    insert(hash, std::move(entry));
+}
+
+void ProvingKeyCache::set_verification_key(const Hash& hash,
+                                           Entry& entry,
+                                           std::shared_ptr<proof_system::plonk::verification_key> verification_key)
+{
+    entry.verification_key = std::move(verification_key);
+    if (!directory_.empty()) {
+        write_bytes(path(hash, "vk"), to_buffer(*entry.verification_key));
+    }
+}
+
+size_t ProvingKeyCache::size() const
+{
+    std::unique_lock lock(mutex_);
+    return entries_.size();
+}
+
+void ProvingKeyCache::set_capacity(size_t capacity)
+{
+    std::unique_lock lock(mutex_);
+    capacity_ = capacity;
+    while (entries_.size() > capacity_) {
+        entries_.pop_back();
+    }
+}
+
+bool ProvingKeyCache::enabled() const
+{
+    std::unique_lock lock(mutex_);
+    return capacity_ > 0 || !directory_.empty();
+}
+
+std::string ProvingKeyCache::path(const Hash& hash, const std::string& extension) const
+{
+    std::ostringstream stream;
+    stream << directory_ << "/" << hash << "." << extension;
+    return stream.str();
+}
+
+std::shared_ptr<ProvingKeyCache::Entry> ProvingKeyCache::read_from_directory(const Hash& hash) const
+{
+    // The sizes are written last, so a circuit whose sizes are there has a complete proving key.
+    if (directory_.empty() || !file_exists(path(hash, "sizes"))) {
+        return nullptr;
+    }
+    auto entry = std::make_shared<Entry>();
+    const auto sizes = read_bytes(path(hash, "sizes"));
+    const auto* it = sizes.data();
+    uint64_t exact_circuit_size = 0;
+    uint64_t total_circuit_size = 0;
+    serialize::read(it, exact_circuit_size);
+    serialize::read(it, total_circuit_size);
+    entry->exact_circuit_size = exact_circuit_size;
+    entry->total_circuit_size = total_circuit_size;
+
+    proof_system::plonk::proving_key_data data;
+    proof_system::plonk::read_mapped(path(hash, "pk"), data);
+    entry->circuit_subgroup_size = data.circuit_size;
+    auto crs = barretenberg::srs::get_crs_factory()->get_prover_crs(data.circuit_size + 1);
+    entry->proving_key = std::make_shared<proof_system::plonk::proving_key>(std::move(data), crs);
+
+    if (file_exists(path(hash, "vk"))) {
+        entry->verification_key = from_buffer<std::shared_ptr<proof_system::plonk::verification_key>>(
+            read_bytes(path(hash, "vk")));
+    }
+    return entry;
+}
+
+void ProvingKeyCache::write_to_directory(const Hash& hash, Entry& entry) const
+{
+    write_atomically(path(hash, "pk"), [&](const std::string& temporary_path) {
+        proof_system::plonk::write_mapped(temporary_path, *entry.proving_key);
+    });
+    std::vector<uint8_t> sizes;
+    serialize::write(sizes, static_cast<uint64_t>(entry.exact_circuit_size));
+    serialize::write(sizes, static_cast<uint64_t>(entry.total_circuit_size));
+    write_bytes(path(hash, "sizes"), sizes);
+}
+
+void ProvingKeyCache::insert(const Hash& hash, std::shared_ptr<Entry> entry)
+{
+    std::unique_lock lock(mutex_);
+    if (capacity_ == 0) {
+        return;
+    }
+    std::erase_if(entries_, [&](const auto& cached) { return cached.first == hash; });
+    entries_.emplace_front(hash, std::move(entry));
+    if (entries_.size() > capacity_) {
+        entries_.pop_back();
+    }
+}
+
+ProvingKeyCache& get_proving_key_cache()
+{
+    static ProvingKeyCache cache = create_from_env();
+    return cache;
+}
+
+void enable_proving_key_cache(size_t capacity)
+{
+    if (get_capacity_from_env() == nullptr) {
+        get_proving_key_cache().set_capacity(capacity);
+    }
+}
+
+} // namespace acir_proofs
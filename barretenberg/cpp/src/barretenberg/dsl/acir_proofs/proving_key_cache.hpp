@@ -0,0 +1,103 @@
+#pragma once
+#include "barretenberg/crypto/sha256/sha256.hpp"
+#include "barretenberg/dsl/acir_format/acir_format.hpp"
+#include "barretenberg/dsl/acir_format/circuit_template.hpp"
+#include "barretenberg/plonk/proof_system/proving_key/proving_key.hpp"
+#include "barretenberg/plonk/proof_system/verification_key/verification_key.hpp"
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace acir_proofs {
+
+/**
+ * @brief A cache of the proving and verification keys of ACIR circuits, keyed by a hash of their constraint systems.
+ *
+ * @details Up to `capacity` circuits are kept in memory, the least recently used being evicted first. If a directory is
+ * given, keys are also written to it, the proving key as a polynomial file (see write_mapped), and keys that are not in
+ * memory are mapped from it. Those outlive the process and share their pages with every other process on the host.
+ *
+ * The cache used by AcirComposer by default (see get_proving_key_cache) is disabled unless the process enables it, as
+ * `bb serve` does, or the environment does: BB_PROVING_KEY_CACHE_SIZE sets the number of circuits kept in memory, and
+ * BB_PROVING_KEY_CACHE_DIR the directory.
+ */
+class ProvingKeyCache {
+  public:
+    using Hash = sha256::hash;
+
+    // The number of circuits kept in memory by the processes that enable the cache
+    static constexpr size_t DEFAULT_CAPACITY = 4;
+
+    struct Entry {
+        size_t exact_circuit_size = 0;
+        size_t total_circuit_size = 0;
+        size_t circuit_subgroup_size = 0;
+        std::shared_ptr<proof_system::plonk::proving_key> proving_key;
+        // Computed on first use, see set_verification_key
+        std::shared_ptr<proof_system::plonk::verification_key> verification_key;
+        // Recorded by the first proof, if the circuit can be populated with only a witness. Not written to the directory.
+        std::shared_ptr<const acir_format::CircuitTemplate> circuit_template;
+        // Held while the proving key is used, as it holds the witness of the proof being made with it, and while the
+        // verification key or circuit template is read or set.
+        std::mutex mutex;
+    };
+
+    ProvingKeyCache(size_t capacity, std::string directory = "");
+
+    /**
+     * @brief The hash of the msgpack serialization of a constraint system
+     */
+    static Hash compute_hash(const acir_format::acir_format& constraint_system);
+
+    /**
+     * @return The keys of a circuit, or nullptr if they are neither in memory nor in the directory
+     */
+    std::shared_ptr<Entry> get(const Hash& hash);
+
+    void put(const Hash& hash, std::shared_ptr<Entry> entry);
+
+    /**
+     * @brief Set the verification key of an entry, and write it to the directory. The entry's mutex must be held.
+     */
+    void set_verification_key(const Hash& hash,
+                              Entry& entry,
+                              std::shared_ptr<proof_system::plonk::verification_key> verification_key);
+
+    size_t size() const;
+
+    /**
+     * @brief Set the number of circuits kept in memory, evicting the least recently used ones beyond it
+     */
+    void set_capacity(size_t capacity);
+
+    bool enabled() const;
+
+  private:
+    std::string path(const Hash& hash, const std::string& extension) const;
+
+    std::shared_ptr<Entry> read_from_directory(const Hash& hash) const;
+
+    void write_to_directory(const Hash& hash, Entry& entry) const;
+
+    void insert(const Hash& hash, std::shared_ptr<Entry> entry);
+
+    mutable std::mutex mutex_;
+    size_t capacity_;
+    std::string directory_;
+    // Most recently used first
+    std::list<std::pair<Hash, std::shared_ptr<Entry>>> entries_;
+};
+
+/**
+ * @brief The process-wide cache, configured from the environment on first use
+ */
+ProvingKeyCache& get_proving_key_cache();
+
+/**
+ * @brief Keep `capacity` circuits in memory in the process-wide cache, unless BB_PROVING_KEY_CACHE_SIZE sets it
+ */
+void enable_proving_key_cache(size_t capacity = ProvingKeyCache::DEFAULT_CAPACITY);
+
+} // namespace acir_proofs
@@ -0,0 +1,147 @@
+#include "proving_key_cache.hpp"
+#include "acir_composer.hpp"
+#include "barretenberg/srs/global_crs.hpp"
+#include <filesystem>
+#include <gtest/gtest.h>
+
+namespace acir_proofs::tests {
+
+class ProvingKeyCacheTests : public ::testing::Test {
+  protected:
+    static void SetUpTestSuite() { barretenberg::srs::init_crs_factory("../srs_db/ignition"); }
+
+    // a + b = c, on witnesses 1, 2 and 3
+    static acir_format::acir_format create_constraint_system(barretenberg::fr q_c = 0)
+    {
+        poly_triple constraint{
+            .a = 1,
+            .b = 2,
+            .c = 3,
+            .q_m = 0,
+            .q_l = 1,
+            .q_r = 1,
+            .q_o = -1,
+            .q_c = q_c,
+        };
+        return acir_format::acir_format{
+            .varnum = 4,
+            .public_inputs = { 1 },
+            .logic_constraints = {},
+            .range_constraints = {},
+            .sha256_constraints = {},
+            .schnorr_constraints = {},
+            .ecdsa_k1_constraints = {},
+            .ecdsa_r1_constraints = {},
+            .blake2s_constraints = {},
+            .keccak_constraints = {},
+            .keccak_var_constraints = {},
+            .pedersen_constraints = {},
+            .hash_to_field_constraints = {},
+            .fixed_base_scalar_mul_constraints = {},
+            .recursion_constraints = {},
+            .constraints = { constraint },
+            .block_constraints = {},
+        };
+    }
+};
+
+TEST_F(ProvingKeyCacheTests, HashIdentifiesConstraintSystem)
+{
+    EXPECT_EQ(ProvingKeyCache::compute_hash(create_constraint_system()),
+              ProvingKeyCache::compute_hash(create_constraint_system()));
+    EXPECT_NE(ProvingKeyCache::compute_hash(create_constraint_system()),
+              ProvingKeyCache::compute_hash(create_constraint_system(1)));
+}
+
+TEST_F(ProvingKeyCacheTests, EvictsLeastRecentlyUsed)
+{
+    ProvingKeyCache cache(2);
+    std::array<ProvingKeyCache::Hash, 3> hashes{};
+    for (size_t i = 0; i < hashes.size(); ++i) {
+        hashes[i][0] = static_cast<uint8_t>(i);
+    }
+    cache.put(hashes[0], std::make_shared<ProvingKeyCache::Entry>());
+    cache.put(hashes[1], std::make_shared<ProvingKeyCache::Entry>());
+    EXPECT_NE(cache.get(hashes[0]), nullptr);
+    cache.put(hashes[2], std::make_shared<ProvingKeyCache::Entry>());
+
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_NE(cache.get(hashes[0]), nullptr);
+    EXPECT_EQ(cache.get(hashes[1]), nullptr);
+    EXPECT_NE(cache.get(hashes[2]), nullptr);
+
+    cache.set_capacity(1);
+    EXPECT_EQ(cache.size(), 1);
+    EXPECT_NE(cache.get(hashes[2]), nullptr);
+    EXPECT_EQ(cache.get(hashes[0]), nullptr);
+}
+
+// A second composer of the same circuit takes its keys from the cache, and proves with different witnesses.
+TEST_F(ProvingKeyCacheTests, ComposersShareKeys)
+{
+    ProvingKeyCache cache(ProvingKeyCache::DEFAULT_CAPACITY);
+    auto constraint_system = create_constraint_system(5);
+    AcirComposer composer(0, false, cache);
+    composer.init_proving_key(constraint_system);
+    auto verification_key = composer.init_verification_key();
+
+    auto entry = cache.get(ProvingKeyCache::compute_hash(constraint_system));
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->verification_key, verification_key);
+
+    AcirComposer other_composer(0, false, cache);
+    acir_format::WitnessVector witness{ 1, 2, 8 };
+    auto proof = other_composer.create_proof(constraint_system, witness, false);
+    EXPECT_EQ(other_composer.get_circuit_subgroup_size(), composer.get_circuit_subgroup_size());
+    EXPECT_EQ(other_composer.init_verification_key(), verification_key);
+    EXPECT_TRUE(other_composer.verify_proof(proof, false));
+    EXPECT_TRUE(composer.verify_proof(proof, false));
+
+    // The circuit of the first proof is recorded, and later proofs only populate it with their witness.
+    ASSERT_NE(entry->circuit_template, nullptr);
+    acir_format::WitnessVector other_witness{ 3, 4, 12 };
+    auto other_proof = other_composer.create_proof(constraint_system, other_witness, false);
+    EXPECT_TRUE(composer.verify_proof(other_proof, false));
+}
+
+// Keys written to the directory by one cache are mapped by another, e.g. in another process.
+TEST_F(ProvingKeyCacheTests, KeysOutliveCacheInDirectory)
+{
+    const std::string directory = std::filesystem::temp_directory_path() / "proving_key_cache_test";
+    std::filesystem::create_directories(directory);
+    auto constraint_system = create_constraint_system(7);
+    const auto hash = ProvingKeyCache::compute_hash(constraint_system);
+
+    acir_format::WitnessVector witness{ 1, 2, 10 };
+    auto builder = acir_format::create_circuit_with_witness(constraint_system, witness);
+    const size_t exact_circuit_size = builder.get_num_gates();
+    acir_format::Composer composer;
+    {
+        ProvingKeyCache cache(0, directory);
+        auto entry = std::make_shared<ProvingKeyCache::Entry>();
+        entry->exact_circuit_size = exact_circuit_size;
+        entry->proving_key = composer.compute_proving_key(builder);
+        entry->circuit_subgroup_size = entry->proving_key->circuit_size;
+        cache.put(hash, entry);
+        std::unique_lock lock(entry->mutex);
+        cache.set_verification_key(hash, *entry, composer.compute_verification_key(builder));
+        EXPECT_EQ(cache.size(), 0);
+    }
+
+    ProvingKeyCache cache(0, directory);
+    auto entry = cache.get(hash);
+    std::filesystem::remove_all(directory);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->exact_circuit_size, exact_circuit_size);
+    EXPECT_EQ(entry->circuit_subgroup_size, composer.circuit_proving_key->circuit_size);
+    ASSERT_NE(entry->verification_key, nullptr);
+    EXPECT_EQ(entry->verification_key->as_data(), composer.circuit_verification_key->as_data());
+
+    acir_format::Composer mapped_composer(entry->proving_key, entry->verification_key);
+    auto prover = mapped_composer.create_ultra_with_keccak_prover(builder);
+    auto proof = prover.construct_proof();
+    auto verifier = mapped_composer.create_ultra_with_keccak_verifier(builder);
+    EXPECT_TRUE(verifier.verify_proof(proof));
+}
+
+} // namespace acir_proofs::tests
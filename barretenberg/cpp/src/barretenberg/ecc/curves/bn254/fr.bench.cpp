@@ -1,4 +1,5 @@
 #include "fr.hpp"
+#include "barretenberg/ecc/fields/field_vector.hpp"
 #include <benchmark/benchmark.h>
 
 using namespace benchmark;
@@ -436,5 +437,50 @@ void pow_bench(State& state) noexcept
 }
 BENCHMARK(pow_bench);
 
+// Elementwise products of the points, in blocks that stay in cache, with the scalar multiplication and with the
+// vectorised kernels of field_vector (which fall back to the scalar multiplication if the CPU lacks AVX-512 IFMA)
+constexpr size_t ELEMENTWISE_BLOCK_SIZE = 1 << 12;
+
+void elementwise_mul_bench(State& state) noexcept
+{
+    std::vector<fr> products(ELEMENTWISE_BLOCK_SIZE);
+    uint64_t clocks = 0;
+    uint64_t count = 0;
+    for (auto _ : state) {
+        uint64_t before = rdtsc();
+        for (size_t i = 0; i < NUM_POINTS; i += ELEMENTWISE_BLOCK_SIZE) {
+            for (size_t j = 0; j < ELEMENTWISE_BLOCK_SIZE; ++j) {
+                products[j] = oldx[i + j] * oldy[i + j];
+            }
+            DoNotOptimize(products.data());
+        }
+        clocks += (rdtsc() - before);
+        ++count;
+    }
+    double average = static_cast<double>(clocks) / (static_cast<double>(count) * static_cast<double>(NUM_POINTS));
+    std::cout << "elementwise mul clocks per operation = " << average << std::endl;
+}
+BENCHMARK(elementwise_mul_bench);
+
+void field_vector_mul_bench(State& state) noexcept
+{
+    std::vector<fr> products(ELEMENTWISE_BLOCK_SIZE);
+    uint64_t clocks = 0;
+    uint64_t count = 0;
+    for (auto _ : state) {
+        uint64_t before = rdtsc();
+        for (size_t i = 0; i < NUM_POINTS; i += ELEMENTWISE_BLOCK_SIZE) {
+            field_vector::mul<fr>({ &oldx[i], ELEMENTWISE_BLOCK_SIZE }, { &oldy[i], ELEMENTWISE_BLOCK_SIZE }, products);
+            DoNotOptimize(products.data());
+        }
+        clocks += (rdtsc() - before);
+        ++count;
+    }
+    double average = static_cast<double>(clocks) / (static_cast<double>(count) * static_cast<double>(NUM_POINTS));
+    std::cout << "field_vector mul clocks per operation = " << average
+              << (field_vector::has_vector_kernels() ? " (avx512 ifma)" : " (scalar)") << std::endl;
+}
+BENCHMARK(field_vector_mul_bench);
+
 // NOLINTNEXTLINE macro invokation triggers style guideline errors from googletest code
 BENCHMARK_MAIN();
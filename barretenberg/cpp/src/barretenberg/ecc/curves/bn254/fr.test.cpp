@@ -360,6 +360,26 @@ TEST(fr, BatchInvert)
     }
 }
 
+TEST(fr, ParallelBatchInvertSkipsZeros)
+{
+    // enough elements for several chunks, not a multiple of the number of lanes
+    const size_t n = fr::PARALLEL_BATCH_INVERT_MIN_CHUNK_SIZE * 3 + 3;
+    std::vector<fr> coeffs(n);
+    for (size_t i = 0; i < n; ++i) {
+        coeffs[i] = (i % 7 == 0) ? fr::zero() : fr::random_element();
+    }
+    std::vector<fr> inverses = coeffs;
+    fr::parallel_batch_invert(inverses);
+
+    for (size_t i = 0; i < n; ++i) {
+        if (coeffs[i].is_zero()) {
+            EXPECT_TRUE(inverses[i].is_zero());
+        } else {
+            EXPECT_EQ(coeffs[i] * inverses[i], fr::one());
+        }
+    }
+}
+
 TEST(fr, MultiplicativeGenerator)
 {
     EXPECT_EQ(fr::multiplicative_generator(), fr(5));
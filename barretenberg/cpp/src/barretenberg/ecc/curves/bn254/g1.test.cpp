@@ -303,6 +303,27 @@ TEST(g1, BatchNormalize)
     }
 }
 
+TEST(g1, BatchNormalizeSkipsPointsAtInfinity)
+{
+    // not a multiple of the number of lanes
+    const size_t num_points = g1::element::BATCH_NORMALIZE_LANES * 250 + 1;
+    std::vector<g1::element> points(num_points);
+    g1::element accumulator = g1::element::random_element();
+    const g1::element step = g1::element::random_element();
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = (i % 5 == 0) ? g1::element::infinity() : accumulator;
+        accumulator += step;
+    }
+    std::vector<g1::element> normalized = points;
+    g1::element::batch_normalize(&normalized[0], num_points);
+
+    for (size_t i = 0; i < num_points; ++i) {
+        EXPECT_EQ(normalized[i].is_point_at_infinity(), points[i].is_point_at_infinity());
+        EXPECT_EQ(normalized[i].z == fq::one(), true);
+        EXPECT_EQ(normalized[i] == points[i], true);
+    }
+}
+
 TEST(g1, GroupExponentiationCheckAgainstConstants)
 {
     fr a{ 0xb67299b792199cf0, 0xc1da7df1e7e12768, 0x692e427911532edf, 0x13dd85e87dc89978 };
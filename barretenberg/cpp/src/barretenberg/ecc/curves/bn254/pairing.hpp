@@ -56,6 +56,11 @@ inline fq12 reduced_ate_pairing_batch_precomputed(const g1::affine_element* P_af
                                                   const miller_lines* lines,
                                                   size_t num_points);
 
+inline bool pairing_check_batch_precomputed(const g1::affine_element* P_affines,
+                                            const miller_lines* lines,
+                                            size_t num_pairs,
+                                            size_t num_claims);
+
 } // namespace barretenberg::pairing
 
 #include "./pairing_impl.hpp"
\ No newline at end of file
@@ -127,4 +127,28 @@ TEST(pairing, ReducedAtePairingPrecomputeConsistencyCheckBatch)
     fq12 expected = pairing::reduced_ate_pairing_batch(&P_b[0], &Q_b[0], num_points).from_montgomery_form();
 
     EXPECT_EQ(result, expected);
-}
\ No newline at end of file
+}
+TEST(pairing, PairingCheckBatchPrecomputed)
+{
+    constexpr size_t num_claims = 8;
+    const fr s = fr::random_element();
+    const g2::affine_element Q = g2::element::random_element();
+    const g2::affine_element sQ = Q * s;
+    pairing::miller_lines lines[2];
+    pairing::precompute_miller_lines(g2::element(sQ), lines[0]);
+    pairing::precompute_miller_lines(g2::element(Q), lines[1]);
+
+    // every claim e(P, s⋅Q)⋅e(-s⋅P, Q) = 1 holds
+    std::vector<g1::affine_element> points;
+    for (size_t i = 0; i < num_claims; ++i) {
+        const g1::element P = g1::element::random_element();
+        points.emplace_back(P);
+        points.emplace_back(-(P * s));
+    }
+    EXPECT_TRUE(pairing::pairing_check_batch_precomputed(&points[0], lines, 2, num_claims));
+
+    // a single false claim fails the batch, but not the claims before it
+    points[5] = g1::element(points[5]) + g1::element::random_element();
+    EXPECT_FALSE(pairing::pairing_check_batch_precomputed(&points[0], lines, 2, num_claims));
+    EXPECT_TRUE(pairing::pairing_check_batch_precomputed(&points[0], lines, 2, 2));
+}
@@ -3,6 +3,7 @@
 #include "./fq12.hpp"
 #include "./g1.hpp"
 #include "./g2.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/curves/bn254/pairing.hpp"
 
 namespace barretenberg::pairing {
@@ -298,4 +299,55 @@ fq12 reduced_ate_pairing_batch(const g1::affine_element* P_affines,
     return result;
 }
 
+/**
+ * @brief Check `num_claims` independent pairing claims against the same fixed G2 points in a single multi-pairing.
+ *
+ * @details Claim i holds if e(P_{i,0}, Q_0) ⋅ ... ⋅ e(P_{i,num_pairs - 1}, Q_{num_pairs - 1}) = 1, where the
+ * precomputed `lines` are those of Q_0, ..., Q_{num_pairs - 1} and the points of claim i are
+ * P_affines[i * num_pairs, (i + 1) * num_pairs). The claims are combined with random coefficients r_i into the single
+ * claim ∏_j e(∑_i r_i⋅P_{i,j}, Q_j) = 1, so that there are only `num_pairs` Miller loops and one final exponentiation
+ * however many claims are checked. If any claim does not hold, the combined claim holds with probability 1/|Fr|.
+ *
+ * @return true if all claims hold
+ */
+bool pairing_check_batch_precomputed(const g1::affine_element* P_affines,
+                                     const miller_lines* lines,
+                                     const size_t num_pairs,
+                                     const size_t num_claims)
+{
+    if (num_claims == 0) {
+        return true;
+    }
+    // The coefficients must be unknown to whoever produced the claims. The first claim does not need one.
+    std::vector<fr> coefficients(num_claims);
+    coefficients[0] = fr::one();
+    for (size_t i = 1; i < num_claims; ++i) {
+        coefficients[i] = fr::random_element();
+    }
+
+    std::vector<g1::element> scaled_points(num_claims * num_pairs);
+    parallel_for(num_claims, [&](size_t i) {
+        for (size_t j = 0; j < num_pairs; ++j) {
+            const size_t idx = i * num_pairs + j;
+            const g1::element point(P_affines[idx]);
+            scaled_points[idx] = i == 0 ? point : point * coefficients[i];
+        }
+    });
+
+    std::vector<g1::element> P(num_pairs);
+    for (size_t j = 0; j < num_pairs; ++j) {
+        P[j] = scaled_points[j];
+        for (size_t i = 1; i < num_claims; ++i) {
+            P[j] += scaled_points[i * num_pairs + j];
+        }
+    }
+    g1::element::batch_normalize(&P[0], num_pairs);
+
+    std::vector<g1::affine_element> P_combined(num_pairs);
+    for (size_t j = 0; j < num_pairs; ++j) {
+        P_combined[j] = g1::affine_element(P[j]);
+    }
+    return reduced_ate_pairing_batch_precomputed(&P_combined[0], lines, num_pairs) == fq12::one();
+}
+
 } // namespace barretenberg::pairing
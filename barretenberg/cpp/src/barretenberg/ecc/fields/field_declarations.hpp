@@ -239,6 +239,10 @@ template <class Params_> struct alignas(32) field {
     constexpr field invert() const noexcept;
     static void batch_invert(std::span<field> coeffs) noexcept;
     static void batch_invert(field* coeffs, size_t n) noexcept;
+    static void parallel_batch_invert(std::span<field> coeffs) noexcept;
+    // number of independent running products of batch_invert
+    static constexpr size_t BATCH_INVERT_LANES = 4;
+    static constexpr size_t PARALLEL_BATCH_INVERT_MIN_CHUNK_SIZE = 1UL << 12;
     /**
      * @brief Compute square root of the field element.
      *
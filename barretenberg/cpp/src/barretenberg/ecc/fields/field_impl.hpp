@@ -1,8 +1,11 @@
 #pragma once
 #include "barretenberg/common/slab_allocator.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
+#include <algorithm>
+#include <array>
 #include <memory>
 #include <span>
 #include <type_traits>
@@ -377,52 +380,89 @@ template <class T> void field<T>::batch_invert(field* coeffs, const size_t n) no
     batch_invert(std::span{ coeffs, n });
 }
 
+/**
+ * @brief Invert every non-zero element of `coeffs` in place with Montgomery's trick, i.e. with a single field
+ * inversion. Zero elements are left as they are.
+ *
+ * @details The running products are accumulated in BATCH_INVERT_LANES interleaved lanes, element i going to lane
+ * i % BATCH_INVERT_LANES, so that consecutive multiplications do not depend on each other and can be pipelined. The
+ * final products of the lanes are inverted together.
+ */
 template <class T> void field<T>::batch_invert(std::span<field> coeffs) noexcept
 {
     const size_t n = coeffs.size();
+    const size_t blocks_end = n - (n % BATCH_INVERT_LANES);
 
     auto temporaries_ptr = std::static_pointer_cast<field[]>(get_mem_slab(n * sizeof(field)));
-    auto skipped_ptr = std::static_pointer_cast<bool[]>(get_mem_slab(n));
-    auto temporaries = temporaries_ptr.get();
-    auto* skipped = skipped_ptr.get();
+    auto* temporaries = temporaries_ptr.get();
 
-    field accumulator = one();
-    for (size_t i = 0; i < n; ++i) {
+    // temporaries[i] is the product of the non-zero elements of the lane of i that precede i
+    const auto accumulate = [&](const size_t i, field& accumulator) {
         temporaries[i] = accumulator;
-        if (coeffs[i].is_zero()) {
-            skipped[i] = true;
-        } else {
-            skipped[i] = false;
+        if (!coeffs[i].is_zero()) {
             accumulator *= coeffs[i];
         }
-    }
-
-    // std::vector<field> temporaries;
-    // std::vector<bool> skipped;
-    // temporaries.reserve(n);
-    // skipped.reserve(n);
-
-    // field accumulator = one();
-    // for (size_t i = 0; i < n; ++i) {
-    //     temporaries.emplace_back(accumulator);
-    //     if (coeffs[i].is_zero()) {
-    //         skipped.emplace_back(true);
-    //     } else {
-    //         skipped.emplace_back(false);
-    //         accumulator *= coeffs[i];
-    //     }
-    // }
-
-    accumulator = accumulator.invert();
-
-    field T0;
-    for (size_t i = n - 1; i < n; --i) {
-        if (!skipped[i]) {
-            T0 = accumulator * temporaries[i];
+    };
+    // accumulator is the inverse of the product of the non-zero elements of the lane of i, up to and including i
+    const auto unwind = [&](const size_t i, field& accumulator) {
+        if (!coeffs[i].is_zero()) {
+            const field T0 = accumulator * temporaries[i];
             accumulator *= coeffs[i];
             coeffs[i] = T0;
         }
+    };
+
+    std::array<field, BATCH_INVERT_LANES> accumulators;
+    accumulators.fill(one());
+    for (size_t i = 0; i < blocks_end; i += BATCH_INVERT_LANES) {
+        for (size_t lane = 0; lane < BATCH_INVERT_LANES; ++lane) {
+            accumulate(i + lane, accumulators[lane]);
+        }
+    }
+    for (size_t i = blocks_end; i < n; ++i) {
+        accumulate(i, accumulators[i - blocks_end]);
+    }
+
+    // invert the lane products with one inversion of their product
+    std::array<field, BATCH_INVERT_LANES> inverses;
+    field product = one();
+    for (size_t lane = 0; lane < BATCH_INVERT_LANES; ++lane) {
+        inverses[lane] = product;
+        product *= accumulators[lane];
+    }
+    product = product.invert();
+    for (size_t lane = BATCH_INVERT_LANES - 1; lane < BATCH_INVERT_LANES; --lane) {
+        inverses[lane] *= product;
+        product *= accumulators[lane];
+    }
+
+    for (size_t i = n - 1; i >= blocks_end && i < n; --i) {
+        unwind(i, inverses[i - blocks_end]);
+    }
+    for (size_t i = blocks_end; i > 0; i -= BATCH_INVERT_LANES) {
+        for (size_t lane = 0; lane < BATCH_INVERT_LANES; ++lane) {
+            unwind(i - BATCH_INVERT_LANES + lane, inverses[lane]);
+        }
+    }
+}
+
+/**
+ * @brief batch_invert, with `coeffs` split into one chunk per thread that is inverted independently, at the cost of
+ * one field inversion per chunk. Small inputs are inverted by the calling thread.
+ */
+template <class T> void field<T>::parallel_batch_invert(std::span<field> coeffs) noexcept
+{
+    const size_t n = coeffs.size();
+    const size_t num_chunks = std::min(get_num_cpus(), std::max<size_t>(n / PARALLEL_BATCH_INVERT_MIN_CHUNK_SIZE, 1));
+    if (num_chunks == 1) {
+        batch_invert(coeffs);
+        return;
     }
+    const size_t chunk_size = (n + num_chunks - 1) / num_chunks;
+    parallel_for(num_chunks, [&](size_t j) {
+        const size_t start = j * chunk_size;
+        batch_invert(coeffs.subspan(start, std::min(chunk_size, n - start)));
+    });
 }
 
 template <class T> constexpr field<T> field<T>::tonelli_shanks_sqrt() const noexcept
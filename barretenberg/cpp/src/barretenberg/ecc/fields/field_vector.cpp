@@ -0,0 +1,301 @@
+#include "field_vector.hpp"
+#include "barretenberg/common/assert.hpp"
+#include <array>
+#include <cstdint>
+
+#if defined(__x86_64__) && !defined(__wasm__)
+#define FIELD_VECTOR_HAS_IFMA_KERNELS
+#include <immintrin.h>
+// gcc 12 flags the undefined pass-through operand of the unmasked avx512 shift intrinsics
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+#endif
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-c-arrays)
+namespace barretenberg::field_vector {
+namespace {
+
+#ifdef FIELD_VECTOR_HAS_IFMA_KERNELS
+
+#define FIELD_VECTOR_IFMA_TARGET __attribute__((target("avx512f,avx512ifma")))
+
+// The vectorised multiplication needs a modulus below 2^254, so that the result of a single conditional subtraction is
+// < 2p, like that of the scalar multiplication.
+template <typename Fr> constexpr bool is_vectorisable = Fr::modulus.data[3] < 0x4000000000000000ULL;
+
+constexpr size_t LANES = 8;
+constexpr size_t NUM_LIMBS = 5;
+constexpr size_t LIMB_BITS = 52;
+constexpr uint64_t LIMB_MASK = (1ULL << LIMB_BITS) - 1;
+
+/**
+ * @brief Split a 256-bit integer, given as 4 64-bit words, into 5 52-bit limbs of value⋅2^SHIFT
+ */
+template <size_t SHIFT> constexpr std::array<uint64_t, NUM_LIMBS> to_limbs(const uint64_t* words)
+{
+    return { (words[0] << SHIFT) & LIMB_MASK,
+             ((words[0] >> (52 - SHIFT)) | (words[1] << (12 + SHIFT))) & LIMB_MASK,
+             ((words[1] >> (40 - SHIFT)) | (words[2] << (24 + SHIFT))) & LIMB_MASK,
+             ((words[2] >> (28 - SHIFT)) | (words[3] << (36 + SHIFT))) & LIMB_MASK,
+             words[3] >> (16 - SHIFT) };
+}
+
+/**
+ * @brief The constants of the Montgomery multiplication, broadcast to every lane
+ */
+struct IfmaConstants {
+    __m512i modulus[NUM_LIMBS];
+    __m512i r_inv;
+};
+
+template <typename Fr> FIELD_VECTOR_IFMA_TARGET IfmaConstants get_ifma_constants()
+{
+    const auto modulus = to_limbs<0>(Fr::modulus.data);
+    IfmaConstants constants;
+    for (size_t i = 0; i < NUM_LIMBS; ++i) {
+        constants.modulus[i] = _mm512_set1_epi64(static_cast<int64_t>(modulus[i]));
+    }
+    // -p⁻¹ mod 2^64 reduces to -p⁻¹ mod 2^52
+    constants.r_inv = _mm512_set1_epi64(static_cast<int64_t>(Fr::Params::r_inv & LIMB_MASK));
+    return constants;
+}
+
+/**
+ * @brief Transpose 8 consecutive field elements: words[l] holds the l-th 64-bit word of every element
+ */
+FIELD_VECTOR_IFMA_TARGET inline void load_words(const uint64_t* src, __m512i* words)
+{
+    const __m512i z0 = _mm512_loadu_si512(src);
+    const __m512i z1 = _mm512_loadu_si512(src + 8);
+    const __m512i z2 = _mm512_loadu_si512(src + 16);
+    const __m512i z3 = _mm512_loadu_si512(src + 24);
+    // words 0, 1 and words 2, 3 of 4 elements
+    const __m512i words_01 = _mm512_setr_epi64(0, 4, 8, 12, 1, 5, 9, 13);
+    const __m512i words_23 = _mm512_setr_epi64(2, 6, 10, 14, 3, 7, 11, 15);
+    const __m512i t0 = _mm512_permutex2var_epi64(z0, words_01, z1);
+    const __m512i t1 = _mm512_permutex2var_epi64(z0, words_23, z1);
+    const __m512i t2 = _mm512_permutex2var_epi64(z2, words_01, z3);
+    const __m512i t3 = _mm512_permutex2var_epi64(z2, words_23, z3);
+    const __m512i low_halves = _mm512_setr_epi64(0, 1, 2, 3, 8, 9, 10, 11);
+    const __m512i high_halves = _mm512_setr_epi64(4, 5, 6, 7, 12, 13, 14, 15);
+    words[0] = _mm512_permutex2var_epi64(t0, low_halves, t2);
+    words[1] = _mm512_permutex2var_epi64(t0, high_halves, t2);
+    words[2] = _mm512_permutex2var_epi64(t1, low_halves, t3);
+    words[3] = _mm512_permutex2var_epi64(t1, high_halves, t3);
+}
+
+/**
+ * @brief The inverse of load_words
+ */
+FIELD_VECTOR_IFMA_TARGET inline void store_words(uint64_t* dst, const __m512i* words)
+{
+    // words 0, 1 and words 2, 3, interleaved, of elements 0 to 3 and of elements 4 to 7
+    const __m512i first_elements = _mm512_setr_epi64(0, 8, 1, 9, 2, 10, 3, 11);
+    const __m512i last_elements = _mm512_setr_epi64(4, 12, 5, 13, 6, 14, 7, 15);
+    const __m512i t0 = _mm512_permutex2var_epi64(words[0], first_elements, words[1]);
+    const __m512i t1 = _mm512_permutex2var_epi64(words[0], last_elements, words[1]);
+    const __m512i t2 = _mm512_permutex2var_epi64(words[2], first_elements, words[3]);
+    const __m512i t3 = _mm512_permutex2var_epi64(words[2], last_elements, words[3]);
+    const __m512i even_elements = _mm512_setr_epi64(0, 1, 8, 9, 2, 3, 10, 11);
+    const __m512i odd_elements = _mm512_setr_epi64(4, 5, 12, 13, 6, 7, 14, 15);
+    _mm512_storeu_si512(dst, _mm512_permutex2var_epi64(t0, even_elements, t2));
+    _mm512_storeu_si512(dst + 8, _mm512_permutex2var_epi64(t0, odd_elements, t2));
+    _mm512_storeu_si512(dst + 16, _mm512_permutex2var_epi64(t1, even_elements, t3));
+    _mm512_storeu_si512(dst + 24, _mm512_permutex2var_epi64(t1, odd_elements, t3));
+}
+
+/**
+ * @brief Split the transposed words of 8 elements into 52-bit limbs of value⋅2^SHIFT (see to_limbs)
+ */
+template <int SHIFT>
+FIELD_VECTOR_IFMA_TARGET inline void words_to_limbs(const __m512i* words,
+                                                    __m512i* limbs)
+{
+    const __m512i mask = _mm512_set1_epi64(static_cast<int64_t>(LIMB_MASK));
+    limbs[0] = _mm512_and_si512(_mm512_slli_epi64(words[0], SHIFT), mask);
+    limbs[1] = _mm512_and_si512(
+        _mm512_or_si512(_mm512_srli_epi64(words[0], 52 - SHIFT), _mm512_slli_epi64(words[1], 12 + SHIFT)), mask);
+    limbs[2] = _mm512_and_si512(
+        _mm512_or_si512(_mm512_srli_epi64(words[1], 40 - SHIFT), _mm512_slli_epi64(words[2], 24 + SHIFT)), mask);
+    limbs[3] = _mm512_and_si512(
+        _mm512_or_si512(_mm512_srli_epi64(words[2], 28 - SHIFT), _mm512_slli_epi64(words[3], 36 + SHIFT)), mask);
+    limbs[4] = _mm512_srli_epi64(words[3], 16 - SHIFT);
+}
+
+/**
+ * @brief The inverse of words_to_limbs<0>, for normalised limbs of a value < 2^256
+ */
+FIELD_VECTOR_IFMA_TARGET inline void limbs_to_words(const __m512i* limbs,
+                                                    __m512i* words)
+{
+    words[0] = _mm512_or_si512(limbs[0], _mm512_slli_epi64(limbs[1], 52));
+    words[1] = _mm512_or_si512(_mm512_srli_epi64(limbs[1], 12), _mm512_slli_epi64(limbs[2], 40));
+    words[2] = _mm512_or_si512(_mm512_srli_epi64(limbs[2], 24), _mm512_slli_epi64(limbs[3], 28));
+    words[3] = _mm512_or_si512(_mm512_srli_epi64(limbs[3], 36), _mm512_slli_epi64(limbs[4], 16));
+}
+
+/**
+ * @brief Montgomery multiplication of 8 pairs of elements, in 52-bit limbs
+ *
+ * @details With `a` given as limbs of 16⋅a and `b` as limbs of b, the word-by-word Montgomery multiplication over 5
+ * 52-bit words computes 16⋅a⋅b⋅2^-260 = a⋅b⋅2^-256 (mod p), i.e. the Montgomery product of the scalar field
+ * arithmetic. The accumulators have 12 bits of headroom, so the carries are only propagated once per word of `b`,
+ * from the lowest limb, and once at the end. The result is < 2^256 and, for a, b < 2p, < 2p.
+ */
+FIELD_VECTOR_IFMA_TARGET inline void montgomery_mul(const __m512i* a,
+                                                    const __m512i* b,
+                                                    const IfmaConstants& constants,
+                                                    __m512i* result)
+{
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i mask = _mm512_set1_epi64(static_cast<int64_t>(LIMB_MASK));
+    __m512i t[NUM_LIMBS + 1]{ zero, zero, zero, zero, zero, zero };
+    for (size_t i = 0; i < NUM_LIMBS; ++i) {
+        for (size_t j = 0; j < NUM_LIMBS; ++j) {
+            t[j] = _mm512_madd52lo_epu64(t[j], a[j], b[i]);
+            t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], a[j], b[i]);
+        }
+        // k = t⋅(-p⁻¹) mod 2^52, so that t + k⋅p ≡ 0 mod 2^52
+        const __m512i k = _mm512_madd52lo_epu64(zero, t[0], constants.r_inv);
+        for (size_t j = 0; j < NUM_LIMBS; ++j) {
+            t[j] = _mm512_madd52lo_epu64(t[j], constants.modulus[j], k);
+            t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], constants.modulus[j], k);
+        }
+        // divide by 2^52
+        t[0] = _mm512_add_epi64(t[1], _mm512_srli_epi64(t[0], LIMB_BITS));
+        for (size_t j = 1; j < NUM_LIMBS; ++j) {
+            t[j] = t[j + 1];
+        }
+        t[NUM_LIMBS] = zero;
+    }
+    for (size_t j = 0; j + 1 < NUM_LIMBS; ++j) {
+        t[j + 1] = _mm512_add_epi64(t[j + 1], _mm512_srli_epi64(t[j], LIMB_BITS));
+        t[j] = _mm512_and_si512(t[j], mask);
+    }
+
+    // subtract p, unless that borrows
+    __m512i reduced[NUM_LIMBS];
+    __m512i borrow = zero;
+    for (size_t j = 0; j < NUM_LIMBS; ++j) {
+        reduced[j] = _mm512_add_epi64(_mm512_sub_epi64(t[j], constants.modulus[j]), borrow);
+        borrow = _mm512_srai_epi64(reduced[j], LIMB_BITS);
+        reduced[j] = _mm512_and_si512(reduced[j], mask);
+    }
+    const __mmask8 keep = _mm512_cmplt_epi64_mask(borrow, zero);
+    for (size_t j = 0; j < NUM_LIMBS; ++j) {
+        result[j] = _mm512_mask_blend_epi64(keep, reduced[j], t[j]);
+    }
+}
+
+/**
+ * @brief Multiply the `num_elements` (a multiple of LANES) elements of `a` by those of `b`, or by `b[0]` if
+ * BROADCAST_B, and write the products to `result`, or add them to `result` if ACCUMULATE
+ */
+template <typename Fr, bool BROADCAST_B, bool ACCUMULATE>
+FIELD_VECTOR_IFMA_TARGET void mul_ifma(const Fr* a, const Fr* b, Fr* result, const size_t num_elements)
+{
+    const IfmaConstants constants = get_ifma_constants<Fr>();
+    __m512i words[4];
+    __m512i a_limbs[NUM_LIMBS];
+    __m512i b_limbs[NUM_LIMBS];
+    __m512i product_limbs[NUM_LIMBS];
+    if constexpr (BROADCAST_B) {
+        const auto limbs = to_limbs<0>(b[0].data);
+        for (size_t j = 0; j < NUM_LIMBS; ++j) {
+            b_limbs[j] = _mm512_set1_epi64(static_cast<int64_t>(limbs[j]));
+        }
+    }
+    for (size_t i = 0; i < num_elements; i += LANES) {
+        load_words(a[i].data, words);
+        words_to_limbs<4>(words, a_limbs);
+        if constexpr (!BROADCAST_B) {
+            load_words(b[i].data, words);
+            words_to_limbs<0>(words, b_limbs);
+        }
+        montgomery_mul(a_limbs, b_limbs, constants, product_limbs);
+        limbs_to_words(product_limbs, words);
+        if constexpr (ACCUMULATE) {
+            std::array<Fr, LANES> products;
+            store_words(products[0].data, words);
+            for (size_t j = 0; j < LANES; ++j) {
+                result[i + j] += products[j];
+            }
+        } else {
+            store_words(result[i].data, words);
+        }
+    }
+}
+
+#endif
+
+} // namespace
+
+bool has_vector_kernels()
+{
+#ifdef FIELD_VECTOR_HAS_IFMA_KERNELS
+    static const bool supported = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512ifma");
+    return supported;
+#else
+    return false;
+#endif
+}
+
+template <typename Fr> void mul(std::span<const Fr> a, std::span<const Fr> b, std::span<Fr> result)
+{
+    ASSERT(a.size() == b.size() && a.size() == result.size());
+    const size_t n = a.size();
+    size_t start = 0;
+#ifdef FIELD_VECTOR_HAS_IFMA_KERNELS
+    if (is_vectorisable<Fr> && has_vector_kernels()) {
+        start = n - (n % LANES);
+        mul_ifma<Fr, false, false>(a.data(), b.data(), result.data(), start);
+    }
+#endif
+    for (size_t i = start; i < n; ++i) {
+        result[i] = a[i] * b[i];
+    }
+}
+
+template <typename Fr> void mul(std::span<const Fr> a, const Fr& b, std::span<Fr> result)
+{
+    ASSERT(a.size() == result.size());
+    const size_t n = a.size();
+    size_t start = 0;
+#ifdef FIELD_VECTOR_HAS_IFMA_KERNELS
+    if (is_vectorisable<Fr> && has_vector_kernels()) {
+        start = n - (n % LANES);
+        mul_ifma<Fr, true, false>(a.data(), &b, result.data(), start);
+    }
+#endif
+    for (size_t i = start; i < n; ++i) {
+        result[i] = a[i] * b;
+    }
+}
+
+template <typename Fr> void add_scaled(std::span<const Fr> a, const Fr& b, std::span<Fr> result)
+{
+    ASSERT(a.size() == result.size());
+    const size_t n = a.size();
+    size_t start = 0;
+#ifdef FIELD_VECTOR_HAS_IFMA_KERNELS
+    if (is_vectorisable<Fr> && has_vector_kernels()) {
+        start = n - (n % LANES);
+        mul_ifma<Fr, true, true>(a.data(), &b, result.data(), start);
+    }
+#endif
+    for (size_t i = start; i < n; ++i) {
+        result[i] += a[i] * b;
+    }
+}
+
+template void mul<fr>(std::span<const fr>, std::span<const fr>, std::span<fr>);
+template void mul<fq>(std::span<const fq>, std::span<const fq>, std::span<fq>);
+template void mul<fr>(std::span<const fr>, const fr&, std::span<fr>);
+template void mul<fq>(std::span<const fq>, const fq&, std::span<fq>);
+template void add_scaled<fr>(std::span<const fr>, const fr&, std::span<fr>);
+template void add_scaled<fq>(std::span<const fq>, const fq&, std::span<fq>);
+
+} // namespace barretenberg::field_vector
+// NOLINTEND(cppcoreguidelines-avoid-c-arrays)
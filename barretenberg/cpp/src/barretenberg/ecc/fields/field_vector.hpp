@@ -0,0 +1,48 @@
+#pragma once
+#include "barretenberg/ecc/curves/bn254/fq.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include <span>
+
+/**
+ * @brief Bulk multiplication of vectors of field elements.
+ *
+ * @details Where the CPU supports AVX-512 IFMA (checked once, at runtime), the products are computed 8 at a time: each
+ * block of 8 elements is loaded from memory and transposed into a limb-sliced (structure-of-arrays) layout of five
+ * 52-bit limbs per element, one 8-lane register per limb, multiplied with a vectorised Montgomery multiplication and
+ * transposed back. Elsewhere, and for the tail of the vectors, the scalar field multiplication is used. The results
+ * are equal to those of the scalar path as field elements, but may differ from them in representation, i.e. by a
+ * multiple of the modulus.
+ *
+ * A 4-lane AVX2 kernel (32-bit limbs, with vpmuludq) was measured to be slower than the scalar ADX path and is
+ * therefore not provided.
+ */
+namespace barretenberg::field_vector {
+
+/**
+ * @brief Whether the vectorised kernels are used on this CPU
+ */
+bool has_vector_kernels();
+
+/**
+ * @brief result[i] = a[i] * b[i]. `result` may alias `a` or `b`.
+ */
+template <typename Fr> void mul(std::span<const Fr> a, std::span<const Fr> b, std::span<Fr> result);
+
+/**
+ * @brief result[i] = a[i] * b. `result` may alias `a`.
+ */
+template <typename Fr> void mul(std::span<const Fr> a, const Fr& b, std::span<Fr> result);
+
+/**
+ * @brief result[i] += a[i] * b
+ */
+template <typename Fr> void add_scaled(std::span<const Fr> a, const Fr& b, std::span<Fr> result);
+
+extern template void mul<fr>(std::span<const fr>, std::span<const fr>, std::span<fr>);
+extern template void mul<fq>(std::span<const fq>, std::span<const fq>, std::span<fq>);
+extern template void mul<fr>(std::span<const fr>, const fr&, std::span<fr>);
+extern template void mul<fq>(std::span<const fq>, const fq&, std::span<fq>);
+extern template void add_scaled<fr>(std::span<const fr>, const fr&, std::span<fr>);
+extern template void add_scaled<fq>(std::span<const fq>, const fq&, std::span<fq>);
+
+} // namespace barretenberg::field_vector
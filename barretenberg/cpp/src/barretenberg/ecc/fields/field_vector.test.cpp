@@ -0,0 +1,60 @@
+#include "field_vector.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace barretenberg;
+
+namespace {
+// not a multiple of the number of lanes, and with the edge cases of the reduction
+template <typename Fr> std::vector<Fr> get_test_vector(const size_t n)
+{
+    std::vector<Fr> result(n);
+    for (auto& element : result) {
+        element = Fr::random_element();
+    }
+    result[0] = Fr::zero();
+    result[1] = Fr::one();
+    result[2] = -Fr::one();
+    // the largest coarsely reduced representation, 2p - 1
+    const uint256_t largest = Fr::modulus + Fr::modulus - 1;
+    result[3] = Fr{ largest.data[0], largest.data[1], largest.data[2], largest.data[3] };
+    return result;
+}
+
+template <typename Fr> void test_mul()
+{
+    const size_t n = 77;
+    const auto a = get_test_vector<Fr>(n);
+    const auto b = get_test_vector<Fr>(n);
+    const Fr scalar = Fr::random_element();
+
+    std::vector<Fr> products(n);
+    field_vector::mul<Fr>(a, b, products);
+    std::vector<Fr> scaled(n);
+    field_vector::mul<Fr>(a, scalar, scaled);
+    std::vector<Fr> accumulated = b;
+    field_vector::add_scaled<Fr>(a, scalar, accumulated);
+    std::vector<Fr> in_place = a;
+    field_vector::mul<Fr>(in_place, b, in_place);
+
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(products[i], a[i] * b[i]);
+        EXPECT_EQ(scaled[i], a[i] * scalar);
+        EXPECT_EQ(accumulated[i], b[i] + a[i] * scalar);
+        EXPECT_EQ(in_place[i], products[i]);
+        // the products are coarsely reduced, like those of the scalar multiplication
+        EXPECT_LT(uint256_t(products[i].data[0], products[i].data[1], products[i].data[2], products[i].data[3]),
+                  Fr::modulus + Fr::modulus);
+    }
+}
+} // namespace
+
+TEST(field_vector, MulFr)
+{
+    test_mul<fr>();
+}
+
+TEST(field_vector, MulFq)
+{
+    test_mul<fq>();
+}
@@ -91,6 +91,8 @@ template <class Fq, class Fr, class Params> class alignas(32) element {
     BBERG_INLINE constexpr bool operator==(const element& other) const noexcept;
 
     static void batch_normalize(element* elements, size_t num_elements) noexcept;
+    // number of independent running products of batch_normalize
+    static constexpr size_t BATCH_NORMALIZE_LANES = 4;
     static std::vector<affine_element<Fq, Fr, Params>> batch_mul_with_endomorphism(
         const std::vector<affine_element<Fq, Fr, Params>>& points, const Fr& exponent) noexcept;
 
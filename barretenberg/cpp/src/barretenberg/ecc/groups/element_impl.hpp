@@ -869,27 +869,50 @@ void element<Fq, Fr, T>::conditional_negate_affine(const affine_element<Fq, Fr,
 template <typename Fq, typename Fr, typename T>
 void element<Fq, Fr, T>::batch_normalize(element* elements, const size_t num_elements) noexcept
 {
-    std::vector<Fq> temporaries;
-    temporaries.reserve(num_elements * 2);
-    Fq accumulator = Fq::one();
-
-    // Iterate over the points, computing the product of their z-coordinates.
-    // At each iteration, store the currently-accumulated z-coordinate in `temporaries`
-    for (size_t i = 0; i < num_elements; ++i) {
-        temporaries.emplace_back(accumulator);
+    // The z-coordinates are accumulated in BATCH_NORMALIZE_LANES interleaved lanes, element i going to lane
+    // i % BATCH_NORMALIZE_LANES, so that consecutive multiplications do not depend on each other.
+    constexpr size_t LANES = BATCH_NORMALIZE_LANES;
+    const size_t blocks_end = num_elements - (num_elements % LANES);
+    std::vector<Fq> temporaries(num_elements);
+
+    // Iterate over the points, computing the product of the z-coordinates of each lane.
+    // At each iteration, store the currently-accumulated z-coordinate of the lane in `temporaries`
+    const auto accumulate = [&](const size_t i, Fq& accumulator) {
+        temporaries[i] = accumulator;
         if (!elements[i].is_point_at_infinity()) {
             accumulator *= elements[i].z;
         }
+    };
+    std::array<Fq, LANES> accumulators;
+    accumulators.fill(Fq::one());
+    for (size_t i = 0; i < blocks_end; i += LANES) {
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            accumulate(i + lane, accumulators[lane]);
+        }
+    }
+    for (size_t i = blocks_end; i < num_elements; ++i) {
+        accumulate(i, accumulators[i - blocks_end]);
+    }
+
+    // For the rest of this method we refer to the product of all z-coordinates of a lane as the 'global' z-coordinate
+    // of the lane. Invert the global z-coordinates, with one inversion of their product, and store them in `inverses`
+    std::array<Fq, LANES> inverses;
+    Fq product = Fq::one();
+    for (size_t lane = 0; lane < LANES; ++lane) {
+        inverses[lane] = product;
+        product *= accumulators[lane];
+    }
+    product = product.invert();
+    for (size_t lane = LANES - 1; lane < LANES; --lane) {
+        inverses[lane] *= product;
+        product *= accumulators[lane];
     }
-    // For the rest of this method we refer to the product of all z-coordinates as the 'global' z-coordinate
-    // Invert the global z-coordinate and store in `accumulator`
-    accumulator = accumulator.invert();
 
     /**
      * We now proceed to iterate back down the array of points.
-     * At each iteration we update the accumulator to contain the z-coordinate of the currently worked-upon
+     * At each iteration we update the accumulator of the lane to contain the z-coordinate of the currently worked-upon
      *z-coordinate. We can then multiply this accumulator with `temporaries`, to get a scalar that is equal to the
-     *inverse of the z-coordinate of the point at the next iteration cycle e.g. Imagine we have 4 points, such that:
+     *inverse of the z-coordinate of the point at the next iteration cycle e.g. Imagine a lane has 4 points, such that:
      *
      * accumulator = 1 / z.data[0]*z.data[1]*z.data[2]*z.data[3]
      * temporaries[3] = z.data[0]*z.data[1]*z.data[2]
@@ -907,7 +930,7 @@ void element<Fq, Fr, T>::batch_normalize(element* elements, const size_t num_ele
      *
      * We can then convert out of Jacobian form (x = X / Z^2, y = Y / Z^3) with 4 muls and 1 square.
      **/
-    for (size_t i = num_elements - 1; i < num_elements; --i) {
+    const auto unwind = [&](const size_t i, Fq& accumulator) {
         if (!elements[i].is_point_at_infinity()) {
             Fq z_inv = accumulator * temporaries[i];
             Fq zz_inv = z_inv.sqr();
@@ -916,6 +939,14 @@ void element<Fq, Fr, T>::batch_normalize(element* elements, const size_t num_ele
             accumulator *= elements[i].z;
         }
         elements[i].z = Fq::one();
+    };
+    for (size_t i = num_elements - 1; i >= blocks_end && i < num_elements; --i) {
+        unwind(i, inverses[i - blocks_end]);
+    }
+    for (size_t i = blocks_end; i > 0; i -= LANES) {
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            unwind(i - LANES + lane, inverses[lane]);
+        }
     }
 }
 
@@ -0,0 +1,264 @@
+#include "./mapped_point_table.hpp"
+#include "./runtime_states.hpp"
+#include "./scalar_multiplication.hpp"
+
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <utility>
+#include <vector>
+
+#if !defined(__wasm__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+namespace barretenberg::scalar_multiplication {
+
+/**
+ * A 64-bit FNV-1a style hash of the table, computed over fixed-size blocks in parallel and then over the block hashes,
+ * so that the result does not depend on the number of threads. `size` must be a multiple of 8 bytes.
+ **/
+uint64_t compute_point_table_checksum(const void* data, const size_t size)
+{
+    constexpr uint64_t OFFSET_BASIS = 0xcbf29ce484222325ULL;
+    constexpr uint64_t PRIME = 0x100000001b3ULL;
+    constexpr size_t BLOCK_WORDS = 1UL << 17;
+    const auto* words = static_cast<const uint64_t*>(data);
+    const size_t num_words = size / sizeof(uint64_t);
+    const size_t num_blocks = (num_words + BLOCK_WORDS - 1) / BLOCK_WORDS;
+
+    std::vector<uint64_t> block_hashes(num_blocks);
+    parallel_for(num_blocks, [&](size_t i) {
+        uint64_t hash = OFFSET_BASIS;
+        const size_t block_end = std::min(num_words, (i + 1) * BLOCK_WORDS);
+        for (size_t j = i * BLOCK_WORDS; j < block_end; ++j) {
+            hash = (hash ^ words[j]) * PRIME;
+        }
+        block_hashes[i] = hash;
+    });
+    uint64_t hash = OFFSET_BASIS;
+    for (const uint64_t block_hash : block_hashes) {
+        hash = (hash ^ block_hash) * PRIME;
+    }
+    return hash;
+}
+
+template <typename Curve>
+void write_point_table(const std::string& path, const typename Curve::AffineElement* table, const size_t num_points)
+{
+    using AffineElement = typename Curve::AffineElement;
+    const size_t table_size = num_points * 2 * sizeof(AffineElement);
+    std::vector<char> header(POINT_TABLE_HEADER_SIZE, 0);
+    const point_table_header fields{ .magic = point_table_header::MAGIC,
+                                     .version = point_table_header::VERSION,
+                                     .point_size = static_cast<uint32_t>(sizeof(AffineElement)),
+                                     .num_points = num_points,
+                                     .fingerprint = compute_point_table_fingerprint(table, num_points),
+                                     .checksum = compute_point_table_checksum(table, table_size) };
+    std::memcpy(header.data(), &fields, sizeof(fields));
+
+    const std::string temporary_path =
+        path + ".tmp" + std::to_string(numeric::random::get_engine().get_random_uint64());
+    {
+        std::ofstream file(temporary_path, std::ios::binary);
+        file.write(header.data(), static_cast<std::streamsize>(header.size()));
+        file.write(reinterpret_cast<const char*>(table), static_cast<std::streamsize>(table_size));
+        if (!file) {
+            std::filesystem::remove(temporary_path);
+            throw_or_abort("failed to write point table to " + path);
+        }
+    }
+    std::filesystem::rename(temporary_path, path);
+}
+
+template <typename Curve> mapped_point_table<Curve>::mapped_point_table(const std::string& path, bool verify_checksum)
+{
+    std::string error;
+    if (!map(path, verify_checksum, error)) {
+        throw_or_abort(error);
+    }
+}
+
+template <typename Curve>
+std::optional<mapped_point_table<Curve>> mapped_point_table<Curve>::try_map(const std::string& path,
+                                                                            bool verify_checksum)
+{
+    mapped_point_table table;
+    std::string error;
+    if (!table.map(path, verify_checksum, error)) {
+        return std::nullopt;
+    }
+    return table;
+}
+
+#if !defined(__wasm__)
+template <typename Curve>
+bool mapped_point_table<Curve>::map(const std::string& path, bool verify_checksum, std::string& error)
+{
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        error = "failed to open point table " + path;
+        return false;
+    }
+    struct stat file_stat {};
+    if (fstat(fd, &file_stat) != 0 || static_cast<size_t>(file_stat.st_size) < POINT_TABLE_HEADER_SIZE) {
+        close(fd);
+        error = "point table " + path + " is truncated";
+        return false;
+    }
+    mapping_size = static_cast<size_t>(file_stat.st_size);
+    mapping = mmap(nullptr, mapping_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        mapping = nullptr;
+        error = "failed to map point table " + path;
+        return false;
+    }
+
+    point_table_header header{};
+    std::memcpy(&header, mapping, sizeof(header));
+    const size_t table_size = header.num_points * 2 * sizeof(AffineElement);
+    const bool valid_header = header.magic == point_table_header::MAGIC &&
+                              header.version == point_table_header::VERSION &&
+                              header.point_size == sizeof(AffineElement) &&
+                              mapping_size >= POINT_TABLE_HEADER_SIZE + table_size;
+    const auto* table =
+        reinterpret_cast<const AffineElement*>(static_cast<const char*>(mapping) + POINT_TABLE_HEADER_SIZE);
+    if (!valid_header || compute_point_table_fingerprint(table, header.num_points) != header.fingerprint ||
+        (verify_checksum && compute_point_table_checksum(table, table_size) != header.checksum)) {
+        munmap(mapping, mapping_size);
+        mapping = nullptr;
+        error = "point table " + path + " is corrupt or was written for a different curve or version";
+        return false;
+    }
+    num_points = header.num_points;
+    fingerprint = header.fingerprint;
+    points = reinterpret_cast<AffineElement*>(static_cast<char*>(mapping) + POINT_TABLE_HEADER_SIZE);
+    return true;
+}
+
+template <typename Curve> mapped_point_table<Curve>::~mapped_point_table()
+{
+    if (mapping != nullptr) {
+        munmap(mapping, mapping_size);
+    }
+}
+
+template <typename Curve> void mapped_point_table<Curve>::prefetch(const size_t start, const size_t count) const
+{
+    const auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const auto begin = reinterpret_cast<uintptr_t>(points + (start * 2));
+    const auto end = reinterpret_cast<uintptr_t>(points + ((start + count) * 2));
+    const uintptr_t aligned_begin = begin - (begin % page_size);
+    madvise(reinterpret_cast<void*>(aligned_begin), end - aligned_begin, MADV_WILLNEED);
+}
+
+template <typename Curve> void mapped_point_table<Curve>::release(const size_t start, const size_t count) const
+{
+    // only whole pages inside the range, the pages at either end may be shared with the neighbouring chunks
+    const auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const auto begin = reinterpret_cast<uintptr_t>(points + (start * 2));
+    const auto end = reinterpret_cast<uintptr_t>(points + ((start + count) * 2));
+    const uintptr_t aligned_begin = ((begin + page_size - 1) / page_size) * page_size;
+    const uintptr_t aligned_end = end - (end % page_size);
+    if (aligned_end > aligned_begin) {
+        madvise(reinterpret_cast<void*>(aligned_begin), aligned_end - aligned_begin, MADV_DONTNEED);
+    }
+}
+#else
+template <typename Curve>
+bool mapped_point_table<Curve>::map(const std::string& path, bool /*unused*/, std::string& error)
+{
+    error = "memory-mapped point tables are not supported in wasm: " + path;
+    return false;
+}
+
+template <typename Curve> mapped_point_table<Curve>::~mapped_point_table() = default;
+
+template <typename Curve> void mapped_point_table<Curve>::prefetch(const size_t, const size_t) const {}
+
+template <typename Curve> void mapped_point_table<Curve>::release(const size_t, const size_t) const {}
+#endif
+
+template <typename Curve>
+mapped_point_table<Curve>::mapped_point_table(mapped_point_table&& other) noexcept
+    : mapping(std::exchange(other.mapping, nullptr))
+    , mapping_size(std::exchange(other.mapping_size, 0))
+    , points(std::exchange(other.points, nullptr))
+    , num_points(std::exchange(other.num_points, 0))
+    , fingerprint(std::exchange(other.fingerprint, 0))
+{}
+
+template <typename Curve>
+mapped_point_table<Curve>& mapped_point_table<Curve>::operator=(mapped_point_table&& other) noexcept
+{
+    std::swap(mapping, other.mapping);
+    std::swap(mapping_size, other.mapping_size);
+    std::swap(points, other.points);
+    std::swap(num_points, other.num_points);
+    std::swap(fingerprint, other.fingerprint);
+    return *this;
+}
+
+template <typename Curve>
+typename Curve::Element pippenger_streaming(typename Curve::ScalarField* scalars,
+                                           const mapped_point_table<Curve>& point_table,
+                                           const size_t num_initial_points,
+                                           const size_t chunk_size,
+                                           bool handle_edge_cases)
+{
+    using Element = typename Curve::Element;
+    ASSERT(num_initial_points <= point_table.get_num_points());
+    ASSERT(chunk_size > 0);
+
+    // a power-of-two chunk is evaluated as a single pippenger slice
+    const auto num_chunk_points = static_cast<size_t>(1ULL << numeric::get_msb(static_cast<uint64_t>(chunk_size)));
+    pippenger_runtime_state<Curve> state(std::min(num_chunk_points, num_initial_points));
+
+    Element result;
+    result.self_set_infinity();
+    for (size_t offset = 0; offset < num_initial_points; offset += num_chunk_points) {
+        const size_t num_points = std::min(num_chunk_points, num_initial_points - offset);
+        if (offset + num_points < num_initial_points) {
+            point_table.prefetch(offset + num_points,
+                                 std::min(num_chunk_points, num_initial_points - offset - num_points));
+        }
+        result += pippenger(
+            scalars + offset, point_table.get_points() + (offset * 2), num_points, state, handle_edge_cases);
+        point_table.release(offset, num_points);
+    }
+    return result;
+}
+
+template void write_point_table<curve::BN254>(const std::string& path,
+                                              const curve::BN254::AffineElement* table,
+                                              size_t num_points);
+template void write_point_table<curve::Grumpkin>(const std::string& path,
+                                                 const curve::Grumpkin::AffineElement* table,
+                                                 size_t num_points);
+template class mapped_point_table<curve::BN254>;
+template class mapped_point_table<curve::Grumpkin>;
+template curve::BN254::Element pippenger_streaming<curve::BN254>(curve::BN254::ScalarField* scalars,
+                                                                 const mapped_point_table<curve::BN254>& point_table,
+                                                                 size_t num_initial_points,
+                                                                 size_t chunk_size,
+                                                                 bool handle_edge_cases);
+template curve::Grumpkin::Element pippenger_streaming<curve::Grumpkin>(
+    curve::Grumpkin::ScalarField* scalars,
+    const mapped_point_table<curve::Grumpkin>& point_table,
+    size_t num_initial_points,
+    size_t chunk_size,
+    bool handle_edge_cases);
+} // namespace barretenberg::scalar_multiplication
+// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
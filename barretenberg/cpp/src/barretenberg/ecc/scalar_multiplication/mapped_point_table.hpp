@@ -0,0 +1,140 @@
+#pragma once
+
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace barretenberg::scalar_multiplication {
+
+// Points per chunk of `pippenger_streaming`. Bounds the runtime state to a few hundred MB, independent of the msm size.
+constexpr size_t DEFAULT_STREAMING_CHUNK_SIZE = 1UL << 18;
+
+// The point table file header occupies one page, so that the points that follow it are page aligned.
+constexpr size_t POINT_TABLE_HEADER_SIZE = 4096;
+
+// The number of leading points of a table covered by its fingerprint.
+constexpr size_t POINT_TABLE_FINGERPRINT_POINTS = 64;
+
+struct point_table_header {
+    static constexpr uint64_t MAGIC = 0x454c424154504242; // "BBPTABLE"
+    static constexpr uint32_t VERSION = 3;
+
+    uint64_t magic;
+    uint32_t version;
+    uint32_t point_size;
+    uint64_t num_points;
+    // see compute_point_table_fingerprint
+    uint64_t fingerprint;
+    // of the whole table
+    uint64_t checksum;
+};
+
+uint64_t compute_point_table_checksum(const void* data, size_t size);
+
+/**
+ * @brief The checksum of the first points of an expanded point table of `num_points` points. Tables generated from
+ * the same SRS, whatever their size, have the same fingerprint once they have POINT_TABLE_FINGERPRINT_POINTS points.
+ */
+template <typename AffineElement>
+uint64_t compute_point_table_fingerprint(const AffineElement* table, size_t num_points)
+{
+    const size_t num_fingerprint_points = std::min(num_points, POINT_TABLE_FINGERPRINT_POINTS);
+    return compute_point_table_checksum(table, num_fingerprint_points * 2 * sizeof(AffineElement));
+}
+
+/**
+ * @brief Write a pippenger point table (see `generate_pippenger_point_table`) of `num_points` points to `path`, in
+ * the layout read by `mapped_point_table`. The table holds 2 * `num_points` endomorphism-expanded points.
+ *
+ * The file is written under a temporary name and renamed into place, so concurrent readers never map a partial table.
+ */
+template <typename Curve>
+void write_point_table(const std::string& path, const typename Curve::AffineElement* table, size_t num_points);
+
+/**
+ * @brief A read-only memory mapping of a pippenger point table file.
+ *
+ * The points are paged in on demand, so a table far larger than the memory of the host can be used. `prefetch` and
+ * `release` let a consumer that walks the table in order (`pippenger_streaming`) ask for read-ahead and drop the pages
+ * it is done with from its resident set. Released pages are faulted back in from the file if accessed again.
+ *
+ * The mapping is shared with the page cache, so processes mapping the same table share its physical memory. Mapping
+ * a table only reads its header and the points of its fingerprint, which the owner of the table compares to that of the
+ * SRS it expects (see get_fingerprint). The checksum of the whole table, written with it, is only checked if asked for,
+ * as it reads every page of the table.
+ */
+template <typename Curve> class mapped_point_table {
+  public:
+    using AffineElement = typename Curve::AffineElement;
+
+    explicit mapped_point_table(const std::string& path, bool verify_checksum = false);
+    mapped_point_table(mapped_point_table&& other) noexcept;
+    mapped_point_table& operator=(mapped_point_table&& other) noexcept;
+    mapped_point_table(const mapped_point_table& other) = delete;
+    mapped_point_table& operator=(const mapped_point_table& other) = delete;
+    ~mapped_point_table();
+
+    // pippenger does not write to its point table, but takes a mutable pointer
+    AffineElement* get_points() const { return points; }
+    size_t get_num_points() const { return num_points; }
+    uint64_t get_fingerprint() const { return fingerprint; }
+
+    // Hint the pages holding the expanded points of [start, start + count) will / will no longer be needed.
+    void prefetch(size_t start, size_t count) const;
+    void release(size_t start, size_t count) const;
+
+    // Map the table at `path`, or return nothing if it is missing, truncated, corrupt or of another version.
+    static std::optional<mapped_point_table> try_map(const std::string& path, bool verify_checksum = false);
+
+  private:
+    mapped_point_table() = default;
+    bool map(const std::string& path, bool verify_checksum, std::string& error);
+
+    void* mapping = nullptr;
+    size_t mapping_size = 0;
+    AffineElement* points = nullptr;
+    size_t num_points = 0;
+    uint64_t fingerprint = 0;
+};
+
+/**
+ * @brief Multi-scalar-multiplication against a memory-mapped point table, with bounded memory.
+ *
+ * The msm is evaluated over consecutive chunks of `chunk_size` points (rounded down to a power of two), reusing a
+ * runtime state sized for a single chunk, and the chunk results are accumulated. Table pages are read ahead one chunk
+ * in advance and released once their chunk is done, so the resident set is bounded by the chunk size rather than the
+ * msm size.
+ */
+template <typename Curve>
+typename Curve::Element pippenger_streaming(typename Curve::ScalarField* scalars,
+                                           const mapped_point_table<Curve>& point_table,
+                                           size_t num_initial_points,
+                                           size_t chunk_size = DEFAULT_STREAMING_CHUNK_SIZE,
+                                           bool handle_edge_cases = true);
+
+extern template void write_point_table<curve::BN254>(const std::string& path,
+                                                     const curve::BN254::AffineElement* table,
+                                                     size_t num_points);
+extern template void write_point_table<curve::Grumpkin>(const std::string& path,
+                                                        const curve::Grumpkin::AffineElement* table,
+                                                        size_t num_points);
+extern template class mapped_point_table<curve::BN254>;
+extern template class mapped_point_table<curve::Grumpkin>;
+extern template curve::BN254::Element pippenger_streaming<curve::BN254>(
+    curve::BN254::ScalarField* scalars,
+    const mapped_point_table<curve::BN254>& point_table,
+    size_t num_initial_points,
+    size_t chunk_size = DEFAULT_STREAMING_CHUNK_SIZE,
+    bool handle_edge_cases = true);
+extern template curve::Grumpkin::Element pippenger_streaming<curve::Grumpkin>(
+    curve::Grumpkin::ScalarField* scalars,
+    const mapped_point_table<curve::Grumpkin>& point_table,
+    size_t num_initial_points,
+    size_t chunk_size = DEFAULT_STREAMING_CHUNK_SIZE,
+    bool handle_edge_cases = true);
+} // namespace barretenberg::scalar_multiplication
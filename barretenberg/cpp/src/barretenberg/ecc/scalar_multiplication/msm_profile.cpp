@@ -0,0 +1,251 @@
+#include "./msm_profile.hpp"
+#include "./runtime_states.hpp"
+#include "./scalar_multiplication.hpp"
+
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/ecc/groups/wnaf.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <vector>
+
+namespace barretenberg::scalar_multiplication {
+
+namespace {
+msm_profile& active_profile()
+{
+    static msm_profile profile = [] {
+        const char* path = std::getenv("BB_MSM_PROFILE");
+        if (path == nullptr || *path == 0) {
+            return msm_profile{};
+        }
+        return read_msm_profile(path).value_or(msm_profile{});
+    }();
+    return profile;
+}
+
+size_t get_log_num_points(const size_t num_points)
+{
+    return static_cast<size_t>(numeric::get_msb(static_cast<uint64_t>(num_points)));
+}
+} // namespace
+
+const msm_profile& get_msm_profile()
+{
+    return active_profile();
+}
+
+/**
+ * Replace the active profile. Not thread safe: call this before any msm is run or any runtime state is constructed.
+ **/
+void set_msm_profile(const msm_profile& profile)
+{
+    active_profile() = profile;
+}
+
+/**
+ * Read a profile written by `write_msm_profile`. Returns nothing if the file is missing, malformed, of a different
+ * version, or was tuned on a host with a different number of cpus.
+ *
+ * The format is plain text:
+ *   msm_profile <version>
+ *   num_cpus <num_cpus>
+ *   <log2 num points> <bucket width> <num threads>   (one line per tuned size)
+ **/
+std::optional<msm_profile> read_msm_profile(const std::string& path)
+{
+    std::ifstream file(path);
+    if (!file) {
+        return std::nullopt;
+    }
+    std::string tag;
+    uint32_t version = 0;
+    msm_profile profile;
+    if (!(file >> tag >> version) || tag != "msm_profile" || version != msm_profile::VERSION) {
+        return std::nullopt;
+    }
+    if (!(file >> tag >> profile.num_cpus) || tag != "num_cpus" || profile.num_cpus != get_num_cpus()) {
+        return std::nullopt;
+    }
+    size_t log_num_points = 0;
+    uint32_t bucket_width = 0;
+    uint32_t num_threads = 0;
+    while (file >> log_num_points >> bucket_width >> num_threads) {
+        const bool valid_threads = num_threads == 0 || ((num_threads & (num_threads - 1)) == 0 &&
+                                                        static_cast<size_t>(num_threads) <= get_num_cpus_pow2());
+        if (log_num_points > msm_profile::MAX_LOG_NUM_POINTS || bucket_width > msm_profile::MAX_BUCKET_WIDTH ||
+            !valid_threads) {
+            return std::nullopt;
+        }
+        profile.bucket_widths[log_num_points] = bucket_width;
+        profile.num_threads[log_num_points] = num_threads;
+    }
+    if (!file.eof()) {
+        return std::nullopt;
+    }
+    return profile;
+}
+
+void write_msm_profile(const msm_profile& profile, const std::string& path)
+{
+    std::ofstream file(path);
+    file << "msm_profile " << msm_profile::VERSION << "\n";
+    file << "num_cpus " << profile.num_cpus << "\n";
+    for (size_t i = 0; i <= msm_profile::MAX_LOG_NUM_POINTS; ++i) {
+        if (profile.bucket_widths[i] != 0 || profile.num_threads[i] != 0) {
+            file << i << " " << profile.bucket_widths[i] << " " << profile.num_threads[i] << "\n";
+        }
+    }
+    if (!file) {
+        throw_or_abort("failed to write msm profile to " + path);
+    }
+}
+
+bool load_msm_profile(const std::string& path)
+{
+    auto profile = read_msm_profile(path);
+    if (!profile.has_value()) {
+        return false;
+    }
+    set_msm_profile(*profile);
+    return true;
+}
+
+size_t get_bucket_width(const size_t num_points)
+{
+    const size_t log_num_points = get_log_num_points(num_points);
+    if (num_points != 0 && log_num_points <= msm_profile::MAX_LOG_NUM_POINTS) {
+        const uint32_t bucket_width = get_msm_profile().bucket_widths[log_num_points];
+        if (bucket_width != 0) {
+            return bucket_width;
+        }
+    }
+    return get_optimal_bucket_width(num_points);
+}
+
+size_t get_num_msm_rounds(const size_t num_points)
+{
+    const size_t bits_per_bucket = get_bucket_width(num_points / 2);
+    return WNAF_SIZE(bits_per_bucket + 1);
+}
+
+size_t get_num_msm_threads(const size_t num_initial_points)
+{
+    const size_t max_threads = get_num_cpus_pow2();
+    const size_t log_num_points = get_log_num_points(num_initial_points);
+    if (num_initial_points != 0 && log_num_points <= msm_profile::MAX_LOG_NUM_POINTS) {
+        const size_t num_threads = get_msm_profile().num_threads[log_num_points];
+        if (num_threads != 0 && num_threads <= max_threads) {
+            return num_threads;
+        }
+    }
+    return max_threads;
+}
+
+/**
+ * A slice of 2^k points needs a schedule of 2^(k + 1) * get_num_msm_rounds(2^(k + 1)) entries. With the default
+ * heuristic the largest slice dominates, but a tuned profile need not be monotone, so take the maximum over all slices.
+ **/
+size_t get_point_schedule_size(const size_t num_initial_points)
+{
+    if (num_initial_points == 0) {
+        return 0;
+    }
+    size_t schedule_size = 0;
+    for (size_t k = 0; k <= get_log_num_points(num_initial_points); ++k) {
+        const size_t num_slice_points = static_cast<size_t>(2ULL << k);
+        schedule_size = std::max(schedule_size, num_slice_points * get_num_msm_rounds(num_slice_points));
+    }
+    return schedule_size;
+}
+
+size_t get_max_num_buckets(const size_t num_initial_points)
+{
+    size_t bucket_width = get_bucket_width(num_initial_points);
+    for (size_t k = 0; k <= get_log_num_points(num_initial_points); ++k) {
+        bucket_width = std::max(bucket_width, get_bucket_width(static_cast<size_t>(1ULL << k)));
+    }
+    return static_cast<size_t>(1ULL << bucket_width);
+}
+
+/**
+ * For every power-of-two size above the Strauss threshold, first search the bucket widths around the default heuristic
+ * using all threads, then search the number of threads the rounds are split over using the best width. Each candidate
+ * gets a fresh runtime state (its buffers depend on the candidate) and is timed as the best of a few runs.
+ **/
+template <typename Curve>
+msm_profile tune_msm_profile(typename Curve::AffineElement* points, const size_t max_num_points)
+{
+    using Fr = typename Curve::ScalarField;
+    constexpr size_t NUM_REPETITIONS = 3;
+    constexpr size_t WIDTH_SEARCH_RADIUS = 3;
+
+    const msm_profile original_profile = get_msm_profile();
+    msm_profile profile;
+    profile.num_cpus = static_cast<uint32_t>(get_num_cpus());
+
+    const size_t max_threads = get_num_cpus_pow2();
+    const size_t min_log_num_points = get_log_num_points(max_threads * 8) + 1;
+    const size_t max_log_num_points = std::min(get_log_num_points(max_num_points), msm_profile::MAX_LOG_NUM_POINTS);
+
+    std::vector<Fr> scalars(max_num_points);
+    for (auto& scalar : scalars) {
+        scalar = Fr::random_element();
+    }
+
+    const auto time_candidate = [&](const size_t num_points) {
+        set_msm_profile(profile);
+        pippenger_runtime_state<Curve> state(num_points);
+        auto best = std::chrono::nanoseconds::max();
+        for (size_t i = 0; i < NUM_REPETITIONS; ++i) {
+            const auto start = std::chrono::steady_clock::now();
+            pippenger_dense<Curve>(&scalars[0], points, num_points, state, false);
+            best = std::min(best, std::chrono::steady_clock::now() - start);
+        }
+        return best;
+    };
+
+    for (size_t log_num_points = min_log_num_points; log_num_points <= max_log_num_points; ++log_num_points) {
+        const auto num_points = static_cast<size_t>(1ULL << log_num_points);
+        const size_t default_width = get_optimal_bucket_width(num_points);
+        const size_t min_width = default_width > WIDTH_SEARCH_RADIUS ? default_width - WIDTH_SEARCH_RADIUS : 1;
+        const size_t max_width = std::min(default_width + WIDTH_SEARCH_RADIUS, msm_profile::MAX_BUCKET_WIDTH);
+
+        auto best_time = std::chrono::nanoseconds::max();
+        size_t best_width = default_width;
+        for (size_t width = min_width; width <= max_width; ++width) {
+            profile.bucket_widths[log_num_points] = static_cast<uint32_t>(width);
+            const auto time = time_candidate(num_points);
+            if (time < best_time) {
+                best_time = time;
+                best_width = width;
+            }
+        }
+        profile.bucket_widths[log_num_points] = static_cast<uint32_t>(best_width);
+
+        // Fewer threads than cpus can win for small msms, where the fan-out overhead and the per-thread bucket
+        // reduction outweigh the per-round work. Keep at least 8 points per thread, as `pippenger` requires.
+        size_t best_threads = max_threads;
+        for (size_t num_threads = max_threads / 2; num_threads >= 1 && num_threads * 8 <= num_points;
+             num_threads /= 2) {
+            profile.num_threads[log_num_points] = static_cast<uint32_t>(num_threads);
+            const auto time = time_candidate(num_points);
+            if (time < best_time) {
+                best_time = time;
+                best_threads = num_threads;
+            }
+        }
+        profile.num_threads[log_num_points] = static_cast<uint32_t>(best_threads);
+    }
+
+    set_msm_profile(original_profile);
+    return profile;
+}
+
+template msm_profile tune_msm_profile<curve::BN254>(curve::BN254::AffineElement* points, size_t max_num_points);
+template msm_profile tune_msm_profile<curve::Grumpkin>(curve::Grumpkin::AffineElement* points, size_t max_num_points);
+} // namespace barretenberg::scalar_multiplication
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace barretenberg::scalar_multiplication {
+
+/**
+ * @brief Host-specific pippenger parameters, indexed by log2 of the number of points before the endomorphism split.
+ *
+ * `get_optimal_bucket_width` picks the window size from the point count alone, which ignores core count and cache
+ * sizes. A profile records, per msm size, the bucket width and the number of threads the pippenger rounds are
+ * partitioned over that measured fastest on a given host. A zero entry means the size was not tuned, and the default
+ * heuristic is used.
+ *
+ * Profiles are produced by `tune_msm_profile` (`bb tune`) and are only valid on a host with the same number of cpus.
+ * The active profile is read from the file named by the `BB_MSM_PROFILE` environment variable on first use, and can be
+ * replaced with `set_msm_profile`. The profile must not change while a `pippenger_runtime_state` is alive, as the state
+ * buffers are sized from it.
+ */
+struct msm_profile {
+    static constexpr uint32_t VERSION = 1;
+    static constexpr size_t MAX_LOG_NUM_POINTS = 32;
+    static constexpr size_t MAX_BUCKET_WIDTH = 21;
+
+    uint32_t num_cpus = 0;
+    std::array<uint32_t, MAX_LOG_NUM_POINTS + 1> bucket_widths{};
+    std::array<uint32_t, MAX_LOG_NUM_POINTS + 1> num_threads{};
+
+    bool operator==(const msm_profile& other) const = default;
+};
+
+const msm_profile& get_msm_profile();
+void set_msm_profile(const msm_profile& profile);
+
+std::optional<msm_profile> read_msm_profile(const std::string& path);
+void write_msm_profile(const msm_profile& profile, const std::string& path);
+bool load_msm_profile(const std::string& path);
+
+// Runtime counterparts of `get_optimal_bucket_width` and `get_num_rounds` that consult the active profile.
+size_t get_bucket_width(size_t num_points);
+size_t get_num_msm_rounds(size_t num_points);
+size_t get_num_msm_threads(size_t num_initial_points);
+
+// Buffer sizes that cover every power-of-two slice pippenger may run over `num_initial_points` points.
+size_t get_point_schedule_size(size_t num_initial_points);
+size_t get_max_num_buckets(size_t num_initial_points);
+
+/**
+ * @brief Benchmark candidate bucket widths and round thread partitions for msm sizes up to `max_num_points`.
+ *
+ * `points` must hold `2 * max_num_points` points in the endomorphism-expanded layout used by `pippenger`. The active
+ * profile is left unchanged; the caller decides whether to install and/or persist the result.
+ */
+template <typename Curve> msm_profile tune_msm_profile(typename Curve::AffineElement* points, size_t max_num_points);
+
+extern template msm_profile tune_msm_profile<curve::BN254>(curve::BN254::AffineElement* points,
+                                                           size_t max_num_points);
+extern template msm_profile tune_msm_profile<curve::Grumpkin>(curve::Grumpkin::AffineElement* points,
+                                                              size_t max_num_points);
+} // namespace barretenberg::scalar_multiplication
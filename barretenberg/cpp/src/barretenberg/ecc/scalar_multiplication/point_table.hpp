@@ -1,5 +1,7 @@
 #pragma once
 #include "barretenberg/common/mem.hpp"
+#include "barretenberg/common/proof_arena.hpp"
+#include "barretenberg/common/slab_allocator.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/curves/bn254/g1.hpp"
 #include <memory>
@@ -22,6 +24,8 @@ inline size_t point_table_buf_size(size_t num_points)
 
 template <typename T> inline std::shared_ptr<T[]> point_table_alloc(size_t num_points)
 {
+    // Point tables hold reference strings, which outlive any one proof.
+    ProofArena::Scope heap_scope(nullptr);
     return std::static_pointer_cast<T[]>(get_mem_slab(point_table_buf_size(num_points)));
 }
 
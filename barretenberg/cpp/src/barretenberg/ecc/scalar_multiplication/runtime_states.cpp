@@ -1,4 +1,5 @@
 #include "runtime_states.hpp"
+#include "msm_profile.hpp"
 
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/slab_allocator.hpp"
@@ -11,20 +12,18 @@ namespace barretenberg::scalar_multiplication {
 size_t get_num_pippenger_rounds(const size_t num_points)
 {
     const auto num_points_floor = static_cast<size_t>(1ULL << (numeric::get_msb(num_points)));
-    const auto num_rounds =
-        static_cast<size_t>(barretenberg::scalar_multiplication::get_num_rounds(static_cast<size_t>(num_points_floor)));
+    const auto num_rounds = get_num_msm_rounds(static_cast<size_t>(num_points_floor));
     return num_rounds;
 }
 template <typename Curve>
 pippenger_runtime_state<Curve>::pippenger_runtime_state(const size_t num_initial_points) noexcept
     : num_points(num_initial_points * 2)
-    , num_buckets(static_cast<size_t>(1ULL << barretenberg::scalar_multiplication::get_optimal_bucket_width(
-                                          static_cast<size_t>(num_initial_points))))
+    , num_buckets(get_max_num_buckets(num_initial_points))
     , num_rounds(get_num_pippenger_rounds(static_cast<size_t>(num_points)))
     , num_threads(get_num_cpus_pow2())
     , prefetch_overflow(num_threads * 16)
     , point_schedule_ptr(
-          get_mem_slab((static_cast<size_t>(num_points) * num_rounds + prefetch_overflow) * sizeof(uint64_t)))
+          get_mem_slab((get_point_schedule_size(num_initial_points) + prefetch_overflow) * sizeof(uint64_t)))
     , point_pairs_1_ptr(
           get_mem_slab((static_cast<size_t>(num_points) * 2 + (num_threads * 16)) * sizeof(AffineElement)))
     , point_pairs_2_ptr(
@@ -43,12 +42,8 @@ pippenger_runtime_state<Curve>::pippenger_runtime_state(const size_t num_initial
     using Fq = typename Curve::BaseField;
     using AffineElement = typename Curve::AffineElement;
 
-    const auto num_points_floor = static_cast<size_t>(1ULL << (numeric::get_msb(num_points)));
-    const auto num_buckets = static_cast<size_t>(
-        1ULL << barretenberg::scalar_multiplication::get_optimal_bucket_width(static_cast<size_t>(num_initial_points)));
-    const auto num_rounds =
-        static_cast<size_t>(barretenberg::scalar_multiplication::get_num_rounds(static_cast<size_t>(num_points_floor)));
-
+    const size_t schedule_size = get_point_schedule_size(num_initial_points);
+    const size_t schedule_per_thread = schedule_size / num_threads;
     const size_t points_per_thread = static_cast<size_t>(num_points) / num_threads;
     parallel_for(num_threads, [&](size_t i) {
         const size_t thread_offset = i * points_per_thread;
@@ -59,12 +54,10 @@ pippenger_runtime_state<Curve>::pippenger_runtime_state(const size_t num_initial
                0,
                (points_per_thread + 16) * sizeof(AffineElement));
         memset(reinterpret_cast<void*>(scratch_space + thread_offset), 0, (points_per_thread) * sizeof(Fq));
-        for (size_t j = 0; j < num_rounds; ++j) {
-            const size_t round_offset = (j * static_cast<size_t>(num_points));
-            memset(reinterpret_cast<void*>(point_schedule + round_offset + thread_offset),
-                   0,
-                   points_per_thread * sizeof(uint64_t));
-        }
+        const size_t schedule_end = (i == num_threads - 1) ? schedule_size : (i + 1) * schedule_per_thread;
+        memset(reinterpret_cast<void*>(point_schedule + (i * schedule_per_thread)),
+               0,
+               (schedule_end - (i * schedule_per_thread)) * sizeof(uint64_t));
         memset(reinterpret_cast<void*>(skew_table + thread_offset), 0, points_per_thread * sizeof(bool));
     });
 
@@ -157,6 +150,10 @@ pippenger_runtime_state<Curve>& pippenger_runtime_state<Curve>::operator=(
     other.round_counts = nullptr;
 
     num_points = other.num_points;
+    num_buckets = other.num_buckets;
+    num_rounds = other.num_rounds;
+    num_threads = other.num_threads;
+    prefetch_overflow = other.prefetch_overflow;
     return *this;
 }
 
@@ -165,8 +162,6 @@ affine_product_runtime_state<Curve> pippenger_runtime_state<Curve>::get_affine_p
     const size_t num_threads, const size_t thread_index)
 {
     const auto points_per_thread = static_cast<size_t>(num_points / num_threads);
-    const auto num_buckets =
-        static_cast<size_t>(1U << scalar_multiplication::get_optimal_bucket_width(static_cast<size_t>(num_points) / 2));
 
     scalar_multiplication::affine_product_runtime_state<Curve> product_state;
 
@@ -3,7 +3,10 @@
 #include <cstdint>
 #include <cstdlib>
 #include <memory>
+#include <span>
+#include <vector>
 
+#include "./msm_profile.hpp"
 #include "./process_buckets.hpp"
 #include "./runtime_states.hpp"
 #include "./scalar_multiplication.hpp"
@@ -200,62 +203,108 @@ void compute_wnaf_states(uint64_t* point_schedule,
                          uint64_t* round_counts,
                          const typename Curve::ScalarField* scalars,
                          const size_t num_initial_points)
+{
+    std::array<uint64_t*, 1> point_schedules{ point_schedule };
+    std::array<bool*, 1> skew_tables{ input_skew_table };
+    std::array<uint64_t*, 1> batch_round_counts{ round_counts };
+    std::array<const typename Curve::ScalarField*, 1> batch_scalars{ scalars };
+    compute_wnaf_states_batch<Curve>(
+        point_schedules, skew_tables, batch_round_counts, batch_scalars, num_initial_points);
+}
+
+/**
+ * `compute_wnaf_states_batch` over the scalars at `point_indices`, or over the first `num_initial_points` scalars if
+ * there are none. The point schedules refer to the points at those indices, so that a subset of an msm is evaluated
+ * against the whole point table without compacting its points.
+ **/
+template <typename Curve>
+void compute_wnaf_states_of_indices(std::span<uint64_t*> point_schedules,
+                                    std::span<bool*> input_skew_tables,
+                                    std::span<uint64_t*> round_counts,
+                                    std::span<const typename Curve::ScalarField*> scalars,
+                                    const uint32_t* point_indices,
+                                    const size_t num_initial_points)
 {
     using Fr = typename Curve::ScalarField;
+    const size_t batch_size = scalars.size();
     const size_t num_points = num_initial_points * 2;
-    constexpr size_t MAX_NUM_ROUNDS = 256;
-    constexpr size_t MAX_NUM_THREADS = 128;
-    const size_t num_rounds = get_num_rounds(num_points);
-    const size_t bits_per_bucket = get_optimal_bucket_width(num_initial_points);
+    const size_t num_rounds = get_num_msm_rounds(num_points);
+    const size_t bits_per_bucket = get_bucket_width(num_initial_points);
     const size_t wnaf_bits = bits_per_bucket + 1;
-    const size_t num_threads = get_num_cpus_pow2();
+    const size_t num_threads = get_num_msm_threads(num_initial_points);
     const size_t num_initial_points_per_thread = num_initial_points / num_threads;
-    const size_t num_points_per_thread = num_points / num_threads;
-    std::array<std::array<uint64_t, MAX_NUM_ROUNDS>, MAX_NUM_THREADS> thread_round_counts;
-    for (size_t i = 0; i < num_threads; ++i) {
-        for (size_t j = 0; j < num_rounds; ++j) {
-            thread_round_counts[i][j] = 0;
-        }
-    }
+
+    // thread_round_counts[(k * num_threads + i) * num_rounds + j] = number of entries of msm `k`, thread `i`, round `j`
+    std::vector<uint64_t> thread_round_counts(batch_size * num_threads * num_rounds, 0);
 
     parallel_for(num_threads, [&](size_t i) {
         Fr T0;
-        uint64_t* wnaf_table = &point_schedule[(2 * i) * num_initial_points_per_thread];
-        const Fr* thread_scalars = &scalars[i * num_initial_points_per_thread];
-        bool* skew_table = &input_skew_table[(2 * i) * num_initial_points_per_thread];
-        uint64_t offset = i * num_points_per_thread;
-
-        for (uint64_t j = 0; j < num_initial_points_per_thread; ++j) {
-            T0 = thread_scalars[j].from_montgomery_form();
-            Fr::split_into_endomorphism_scalars(T0, T0, *(Fr*)&T0.data[2]);
-
-            wnaf::fixed_wnaf_with_counts(&T0.data[0],
-                                         &wnaf_table[(j << 1UL)],
-                                         skew_table[j << 1ULL],
-                                         &thread_round_counts[i][0],
-                                         ((j << 1ULL) + offset) << 32ULL,
-                                         num_points,
-                                         wnaf_bits);
-            wnaf::fixed_wnaf_with_counts(&T0.data[2],
-                                         &wnaf_table[(j << 1UL) + 1],
-                                         skew_table[(j << 1UL) + 1],
-                                         &thread_round_counts[i][0],
-                                         ((j << 1UL) + offset + 1) << 32UL,
-                                         num_points,
-                                         wnaf_bits);
+        const uint64_t offset = i * num_initial_points_per_thread;
+        for (size_t k = 0; k < batch_size; ++k) {
+            uint64_t* wnaf_table = &point_schedules[k][(2 * i) * num_initial_points_per_thread];
+            bool* skew_table = &input_skew_tables[k][(2 * i) * num_initial_points_per_thread];
+            uint64_t* counts = &thread_round_counts[(k * num_threads + i) * num_rounds];
+
+            for (uint64_t j = 0; j < num_initial_points_per_thread; ++j) {
+                const uint64_t point_index = point_indices == nullptr ? j + offset : point_indices[j + offset];
+                T0 = scalars[k][point_index].from_montgomery_form();
+                Fr::split_into_endomorphism_scalars(T0, T0, *(Fr*)&T0.data[2]);
+
+                wnaf::fixed_wnaf_with_counts(&T0.data[0],
+                                             &wnaf_table[(j << 1UL)],
+                                             skew_table[j << 1ULL],
+                                             counts,
+                                             (point_index << 1ULL) << 32ULL,
+                                             num_points,
+                                             wnaf_bits);
+                wnaf::fixed_wnaf_with_counts(&T0.data[2],
+                                             &wnaf_table[(j << 1UL) + 1],
+                                             skew_table[(j << 1UL) + 1],
+                                             counts,
+                                             ((point_index << 1UL) + 1) << 32UL,
+                                             num_points,
+                                             wnaf_bits);
+            }
         }
     });
 
-    for (size_t i = 0; i < num_rounds; ++i) {
-        round_counts[i] = 0;
-    }
-    for (size_t i = 0; i < num_threads; ++i) {
+    for (size_t k = 0; k < batch_size; ++k) {
         for (size_t j = 0; j < num_rounds; ++j) {
-            round_counts[j] += thread_round_counts[i][j];
+            round_counts[k][j] = 0;
+        }
+        for (size_t i = 0; i < num_threads; ++i) {
+            const uint64_t* counts = &thread_round_counts[(k * num_threads + i) * num_rounds];
+            for (size_t j = 0; j < num_rounds; ++j) {
+                round_counts[k][j] += counts[j];
+            }
         }
     }
 }
 
+/**
+ * Compute the wnaf states of several scalar multipliers of the same size, sharing one thread fan-out.
+ *
+ * Each thread processes its tranche of every scalar vector in the batch, so thread start-up and the per-thread
+ * round count bookkeeping is paid once per batch rather than once per multi-scalar-multiplication.
+ * See `compute_wnaf_states` for a description of the wnaf representation.
+ *
+ * @param point_schedules Per-msm output arrays for the wnaf entries
+ * @param input_skew_tables Per-msm output arrays for the skews
+ * @param round_counts Per-msm output arrays for the number of points in each round
+ * @param scalars Per-msm scalar multipliers
+ * @param num_initial_points The number of points before the endomorphism split (identical for every msm)
+ **/
+template <typename Curve>
+void compute_wnaf_states_batch(std::span<uint64_t*> point_schedules,
+                               std::span<bool*> input_skew_tables,
+                               std::span<uint64_t*> round_counts,
+                               std::span<const typename Curve::ScalarField*> scalars,
+                               const size_t num_initial_points)
+{
+    compute_wnaf_states_of_indices<Curve>(
+        point_schedules, input_skew_tables, round_counts, scalars, nullptr, num_initial_points);
+}
+
 /**
  *  Sorts our wnaf entries in increasing bucket order (per round).
  *  We currently don't multi-thread the inner sorting algorithm, and just split our threads over the number of rounds.
@@ -264,12 +313,24 @@ void compute_wnaf_states(uint64_t* point_schedule,
  **/
 void organize_buckets(uint64_t* point_schedule, const size_t num_points)
 {
-    const size_t num_rounds = get_num_rounds(num_points);
+    std::array<uint64_t*, 1> point_schedules{ point_schedule };
+    organize_buckets_batch(point_schedules, num_points);
+}
 
-    parallel_for(num_rounds, [&](size_t i) {
-        scalar_multiplication::process_buckets(&point_schedule[i * num_points],
-                                               num_points,
-                                               static_cast<uint32_t>(get_optimal_bucket_width(num_points / 2)) + 1);
+/**
+ * Sorts the wnaf entries of several multi-scalar-multiplications of the same size. The (msm, round) pairs are
+ * distributed over a single thread fan-out, which keeps all threads busy even when there are fewer rounds than threads.
+ **/
+void organize_buckets_batch(std::span<uint64_t*> point_schedules, const size_t num_points)
+{
+    const size_t num_rounds = get_num_msm_rounds(num_points);
+    const auto num_bits = static_cast<uint32_t>(get_bucket_width(num_points / 2)) + 1;
+
+    parallel_for(point_schedules.size() * num_rounds, [&](size_t i) {
+        const size_t msm_index = i / num_rounds;
+        const size_t round_index = i - (msm_index * num_rounds);
+        scalar_multiplication::process_buckets(
+            &point_schedules[msm_index][round_index * num_points], num_points, num_bits);
     });
 }
 
@@ -737,121 +798,199 @@ uint32_t construct_addition_chains(affine_product_runtime_state<Curve>& state, b
     return max_bucket_bits;
 }
 
+/**
+ * Evaluate one pippenger round over a single thread's tranche of a sorted point schedule.
+ *
+ * Returns the concatenated bucket sum of the thread's buckets, scaled to the thread's first bucket.
+ * Skew corrections and the doublings between rounds are applied by the caller.
+ **/
+template <typename Curve>
+typename Curve::Element evaluate_pippenger_round_for_thread(pippenger_runtime_state<Curve>& state,
+                                                            typename Curve::AffineElement* points,
+                                                            uint64_t* round_point_schedule,
+                                                            const uint64_t num_round_points,
+                                                            const size_t num_threads,
+                                                            const size_t thread_index,
+                                                            bool handle_edge_cases)
+{
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+
+    Element accumulator;
+    accumulator.self_set_infinity();
+
+    if ((num_round_points == 0) || (num_round_points < num_threads && thread_index != num_threads - 1)) {
+        return accumulator;
+    }
+
+    const uint64_t num_round_points_per_thread = num_round_points / num_threads;
+    const uint64_t leftovers =
+        (thread_index == num_threads - 1) ? (num_round_points) - (num_round_points_per_thread * num_threads) : 0;
+
+    uint64_t* thread_point_schedule = &round_point_schedule[thread_index * num_round_points_per_thread];
+    const size_t first_bucket = thread_point_schedule[0] & 0x7fffffffU;
+    const size_t last_bucket = thread_point_schedule[(num_round_points_per_thread - 1 + leftovers)] & 0x7fffffffU;
+    const size_t num_thread_buckets = (last_bucket - first_bucket) + 1;
+
+    affine_product_runtime_state<Curve> product_state =
+        state.get_affine_product_runtime_state(num_threads, thread_index);
+    product_state.num_points = static_cast<uint32_t>(num_round_points_per_thread + leftovers);
+    product_state.points = points;
+    product_state.point_schedule = thread_point_schedule;
+    product_state.num_buckets = static_cast<uint32_t>(num_thread_buckets);
+    AffineElement* output_buckets = reduce_buckets(product_state, true, handle_edge_cases);
+    Element running_sum;
+    running_sum.self_set_infinity();
+
+    // one nice side-effect of the affine trick, is that half of the bucket concatenation
+    // algorithm can use mixed addition formulae, instead of full addition formulae
+    size_t output_it = product_state.num_points - 1;
+    for (size_t k = num_thread_buckets - 1; k > 0; --k) {
+        if (__builtin_expect(!product_state.bucket_empty_status[k], 1)) {
+            running_sum += (output_buckets[output_it]);
+            --output_it;
+        }
+        accumulator += running_sum;
+    }
+    running_sum += output_buckets[0];
+    accumulator.self_dbl();
+    accumulator += running_sum;
+
+    // we now need to scale up 'running sum' up to the value of the first bucket.
+    // e.g. if first bucket is 0, no scaling
+    // if first bucket is 1, we need to add (2 * running_sum)
+    if (first_bucket > 0) {
+        auto multiplier = static_cast<uint32_t>(first_bucket << 1UL);
+        size_t shift = numeric::get_msb(multiplier);
+        Element rolling_accumulator = Curve::Group::point_at_infinity;
+        bool init = false;
+        while (shift != static_cast<size_t>(-1)) {
+            if (init) {
+                rolling_accumulator.self_dbl();
+                if (((multiplier >> shift) & 1)) {
+                    rolling_accumulator += running_sum;
+                }
+            } else {
+                rolling_accumulator += running_sum;
+            }
+            init = true;
+            shift -= 1;
+        }
+        accumulator += rolling_accumulator;
+    }
+    return accumulator;
+}
+
 template <typename Curve>
 typename Curve::Element evaluate_pippenger_rounds(pippenger_runtime_state<Curve>& state,
                                                   typename Curve::AffineElement* points,
                                                   const size_t num_points,
                                                   bool handle_edge_cases)
+{
+    std::array<uint64_t*, 1> point_schedules{ state.point_schedule };
+    std::array<bool*, 1> skew_tables{ state.skew_table };
+    std::array<uint64_t*, 1> round_counts{ state.round_counts };
+    return evaluate_pippenger_rounds_batch<Curve>(
+        state, point_schedules, skew_tables, round_counts, points, num_points, handle_edge_cases)[0];
+}
+
+/**
+ * `evaluate_pippenger_rounds_batch` of point schedules computed by `compute_wnaf_states_of_indices`.
+ **/
+template <typename Curve>
+std::vector<typename Curve::Element> evaluate_pippenger_rounds_of_indices(pippenger_runtime_state<Curve>& state,
+                                                                          std::span<uint64_t*> point_schedules,
+                                                                          std::span<bool*> skew_tables,
+                                                                          std::span<uint64_t*> round_counts,
+                                                                          typename Curve::AffineElement* points,
+                                                                          const uint32_t* point_indices,
+                                                                          const size_t num_points,
+                                                                          bool handle_edge_cases)
 {
     using Element = typename Curve::Element;
     using AffineElement = typename Curve::AffineElement;
-    const size_t num_rounds = get_num_rounds(num_points);
-    const size_t num_threads = get_num_cpus_pow2();
-    const size_t bits_per_bucket = get_optimal_bucket_width(num_points / 2);
+    const size_t batch_size = point_schedules.size();
+    const size_t num_rounds = get_num_msm_rounds(num_points);
+    const size_t num_threads = get_num_msm_threads(num_points / 2);
+    const size_t bits_per_bucket = get_bucket_width(num_points / 2);
 
+    // thread_accumulators[k * num_threads + j] is thread `j`'s share of msm `k`
     std::unique_ptr<Element[], decltype(&aligned_free)> thread_accumulators(
-        static_cast<Element*>(aligned_alloc(64, num_threads * sizeof(Element))), &aligned_free);
+        static_cast<Element*>(aligned_alloc(64, batch_size * num_threads * sizeof(Element))), &aligned_free);
 
     parallel_for(num_threads, [&](size_t j) {
-        thread_accumulators[j].self_set_infinity();
+        for (size_t k = 0; k < batch_size; ++k) {
+            thread_accumulators[k * num_threads + j].self_set_infinity();
+        }
 
         for (size_t i = 0; i < num_rounds; ++i) {
-
-            const uint64_t num_round_points = state.round_counts[i];
-
-            Element accumulator;
-            accumulator.self_set_infinity();
-
-            if ((num_round_points == 0) || (num_round_points < num_threads && j != num_threads - 1)) {
-            } else {
-
-                const uint64_t num_round_points_per_thread = num_round_points / num_threads;
-                const uint64_t leftovers =
-                    (j == num_threads - 1) ? (num_round_points) - (num_round_points_per_thread * num_threads) : 0;
-
-                uint64_t* thread_point_schedule =
-                    &state.point_schedule[(i * num_points) + j * num_round_points_per_thread];
-                const size_t first_bucket = thread_point_schedule[0] & 0x7fffffffU;
-                const size_t last_bucket =
-                    thread_point_schedule[(num_round_points_per_thread - 1 + leftovers)] & 0x7fffffffU;
-                const size_t num_thread_buckets = (last_bucket - first_bucket) + 1;
-
-                affine_product_runtime_state<Curve> product_state =
-                    state.get_affine_product_runtime_state(num_threads, j);
-                product_state.num_points = static_cast<uint32_t>(num_round_points_per_thread + leftovers);
-                product_state.points = points;
-                product_state.point_schedule = thread_point_schedule;
-                product_state.num_buckets = static_cast<uint32_t>(num_thread_buckets);
-                AffineElement* output_buckets = reduce_buckets(product_state, true, handle_edge_cases);
-                Element running_sum;
-                running_sum.self_set_infinity();
-
-                // one nice side-effect of the affine trick, is that half of the bucket concatenation
-                // algorithm can use mixed addition formulae, instead of full addition formulae
-                size_t output_it = product_state.num_points - 1;
-                for (size_t k = num_thread_buckets - 1; k > 0; --k) {
-                    if (__builtin_expect(!product_state.bucket_empty_status[k], 1)) {
-                        running_sum += (output_buckets[output_it]);
-                        --output_it;
+            for (size_t k = 0; k < batch_size; ++k) {
+                Element accumulator = evaluate_pippenger_round_for_thread<Curve>(state,
+                                                                                 points,
+                                                                                 &point_schedules[k][i * num_points],
+                                                                                 round_counts[k][i],
+                                                                                 num_threads,
+                                                                                 j,
+                                                                                 handle_edge_cases);
+                Element& thread_accumulator = thread_accumulators[k * num_threads + j];
+                if (i > 0) {
+                    for (size_t l = 0; l < bits_per_bucket + 1; ++l) {
+                        thread_accumulator.self_dbl();
                     }
-                    accumulator += running_sum;
-                }
-                running_sum += output_buckets[0];
-                accumulator.self_dbl();
-                accumulator += running_sum;
-
-                // we now need to scale up 'running sum' up to the value of the first bucket.
-                // e.g. if first bucket is 0, no scaling
-                // if first bucket is 1, we need to add (2 * running_sum)
-                if (first_bucket > 0) {
-                    auto multiplier = static_cast<uint32_t>(first_bucket << 1UL);
-                    size_t shift = numeric::get_msb(multiplier);
-                    Element rolling_accumulator = Curve::Group::point_at_infinity;
-                    bool init = false;
-                    while (shift != static_cast<size_t>(-1)) {
-                        if (init) {
-                            rolling_accumulator.self_dbl();
-                            if (((multiplier >> shift) & 1)) {
-                                rolling_accumulator += running_sum;
-                            }
-                        } else {
-                            rolling_accumulator += running_sum;
-                        }
-                        init = true;
-                        shift -= 1;
-                    }
-                    accumulator += rolling_accumulator;
                 }
+                thread_accumulator += accumulator;
             }
+        }
 
-            if (i == (num_rounds - 1)) {
-                const size_t num_points_per_thread = num_points / num_threads;
-                bool* skew_table = &state.skew_table[j * num_points_per_thread];
-                AffineElement* point_table = &points[j * num_points_per_thread];
-                AffineElement addition_temporary;
-                for (size_t k = 0; k < num_points_per_thread; ++k) {
-                    if (skew_table[k]) {
-                        addition_temporary = -point_table[k];
-                        accumulator += addition_temporary;
+        // subtract the points whose scalar multipliers were made odd by the wnaf skew
+        const size_t num_points_per_thread = num_points / num_threads;
+        const size_t thread_offset = j * num_points_per_thread;
+        AffineElement addition_temporary;
+        for (size_t l = thread_offset; l < thread_offset + num_points_per_thread; ++l) {
+            bool negated = false;
+            for (size_t k = 0; k < batch_size; ++k) {
+                if (skew_tables[k][l]) {
+                    if (!negated) {
+                        const size_t point_index =
+                            point_indices == nullptr ? l : (static_cast<size_t>(point_indices[l >> 1]) << 1) + (l & 1);
+                        addition_temporary = -points[point_index];
+                        negated = true;
                     }
+                    thread_accumulators[k * num_threads + j] += addition_temporary;
                 }
             }
-
-            if (i > 0) {
-                for (size_t k = 0; k < bits_per_bucket + 1; ++k) {
-                    thread_accumulators[j].self_dbl();
-                }
-            }
-            thread_accumulators[j] += accumulator;
         }
     });
 
-    Element result;
-    result.self_set_infinity();
-    for (size_t i = 0; i < num_threads; ++i) {
-        result += thread_accumulators[i];
+    std::vector<Element> results(batch_size);
+    for (size_t k = 0; k < batch_size; ++k) {
+        results[k].self_set_infinity();
+        for (size_t i = 0; i < num_threads; ++i) {
+            results[k] += thread_accumulators[k * num_threads + i];
+        }
     }
-    return result;
+    return results;
+}
+
+/**
+ * Evaluate the pippenger rounds of several multi-scalar-multiplications that share the same point table.
+ *
+ * Every thread works through the rounds of all msms in the batch back-to-back, so a single thread fan-out covers the
+ * whole batch. Within a round, consecutive msms of the batch address the same region of the point table (the thread's
+ * bucket range is similar for uniformly distributed scalars), and the final skew correction walks the thread's points
+ * once, applying the skews of every msm while the point is in cache.
+ **/
+template <typename Curve>
+std::vector<typename Curve::Element> evaluate_pippenger_rounds_batch(pippenger_runtime_state<Curve>& state,
+                                                                     std::span<uint64_t*> point_schedules,
+                                                                     std::span<bool*> skew_tables,
+                                                                     std::span<uint64_t*> round_counts,
+                                                                     typename Curve::AffineElement* points,
+                                                                     const size_t num_points,
+                                                                     bool handle_edge_cases)
+{
+    return evaluate_pippenger_rounds_of_indices<Curve>(
+        state, point_schedules, skew_tables, round_counts, points, nullptr, num_points, handle_edge_cases);
 }
 
 template <typename Curve>
@@ -869,12 +1008,172 @@ typename Curve::Element pippenger_internal(typename Curve::AffineElement* points
     return result;
 }
 
+/**
+ * Scalar categories used by the sparse-scalar pre-pass of `pippenger`.
+ *
+ * The polynomials we commit to are frequently dominated by 0, 1 and small integers (selectors, lookup tables and many
+ * witness columns in Lagrange form). Sending these through the full wnaf decomposition wastes most of the work:
+ * zero scalars are dropped entirely, points with a unit scalar are summed directly and scalars that fit in 64 bits are
+ * evaluated in their own (short) multi-scalar-multiplication, where the wnaf rounds above the scalars' bit length are
+ * empty and the endomorphism split yields no second half-scalar.
+ **/
+enum ScalarCategory : uint8_t { ZERO_SCALAR = 0, ONE_SCALAR, SMALL_SCALAR, FULL_SCALAR, NUM_SCALAR_CATEGORIES };
+
+// Only split an msm into its categories if at least 1 / SPARSE_SCALAR_RATIO of the scalars are zero, one or small;
+// below that the cost of classifying and indexing the scalars outweighs the savings.
+constexpr size_t SPARSE_SCALAR_RATIO = 8;
+
+// The number of scalars sampled to rule out the sparse path before classifying every scalar.
+constexpr size_t SPARSE_SCALAR_SAMPLE_SIZE = 256;
+
+template <typename Fr> ScalarCategory get_scalar_category(const Fr& scalar)
+{
+    const Fr converted = scalar.from_montgomery_form();
+    if ((converted.data[1] | converted.data[2] | converted.data[3]) != 0) {
+        return FULL_SCALAR;
+    }
+    if (converted.data[0] == 0) {
+        return ZERO_SCALAR;
+    }
+    return converted.data[0] == 1 ? ONE_SCALAR : SMALL_SCALAR;
+}
+
+/**
+ * Whether an evenly spaced sample of the scalars has so few zero, one or small scalars that the msm is clearly dense,
+ * i.e. less than half of the share the sparse path needs. Uniformly distributed scalars are ruled out after the sample,
+ * without classifying every scalar.
+ **/
 template <typename Curve>
-typename Curve::Element pippenger(typename Curve::ScalarField* scalars,
-                                  typename Curve::AffineElement* points,
-                                  const size_t num_initial_points,
-                                  pippenger_runtime_state<Curve>& state,
-                                  bool handle_edge_cases)
+bool is_clearly_dense(const typename Curve::ScalarField* scalars, const size_t num_scalars)
+{
+    const size_t num_samples = std::min(num_scalars, SPARSE_SCALAR_SAMPLE_SIZE);
+    size_t num_sparse = 0;
+    for (size_t i = 0; i < num_samples; ++i) {
+        num_sparse += static_cast<size_t>(get_scalar_category(scalars[i * num_scalars / num_samples]) != FULL_SCALAR);
+    }
+    return num_sparse * SPARSE_SCALAR_RATIO * 2 < num_samples;
+}
+
+/**
+ * Count the scalars of each `ScalarCategory` in each of `num_threads` even ranges of the scalars.
+ **/
+template <typename Curve>
+std::vector<std::array<size_t, NUM_SCALAR_CATEGORIES>> classify_scalars(const typename Curve::ScalarField* scalars,
+                                                                        const size_t num_scalars,
+                                                                        const size_t num_threads)
+{
+    const size_t scalars_per_thread = (num_scalars + num_threads - 1) / num_threads;
+    std::vector<std::array<size_t, NUM_SCALAR_CATEGORIES>> thread_counts(num_threads);
+
+    parallel_for(num_threads, [&](size_t j) {
+        auto& counts = thread_counts[j];
+        counts.fill(0);
+        const size_t start = std::min(j * scalars_per_thread, num_scalars);
+        const size_t end = std::min(start + scalars_per_thread, num_scalars);
+        for (size_t i = start; i < end; ++i) {
+            ++counts[get_scalar_category(scalars[i])];
+        }
+    });
+    return thread_counts;
+}
+
+/**
+ * Whether an msm whose scalars fall in `counts` is better evaluated as a whole than by category.
+ **/
+bool is_dense(const std::array<size_t, NUM_SCALAR_CATEGORIES>& counts, const size_t num_scalars)
+{
+    return counts[FULL_SCALAR] * SPARSE_SCALAR_RATIO > num_scalars * (SPARSE_SCALAR_RATIO - 1);
+}
+
+template <typename Curve>
+typename Curve::Element pippenger_of_indices(typename Curve::ScalarField* scalars,
+                                             typename Curve::AffineElement* points,
+                                             const uint32_t* point_indices,
+                                             size_t num_initial_points,
+                                             pippenger_runtime_state<Curve>& state,
+                                             bool handle_edge_cases);
+
+/**
+ * Evaluate an msm by category, against the point table in place: zero scalars are skipped, the points of unit scalars
+ * are summed, and the small and full scalars are evaluated as two smaller msms over their indices (see
+ * `pippenger_of_indices`).
+ *
+ * @param thread_counts The counts of `classify_scalars` of the scalars
+ **/
+template <typename Curve>
+typename Curve::Element pippenger_sparse(typename Curve::ScalarField* scalars,
+                                         typename Curve::AffineElement* points,
+                                         const size_t num_initial_points,
+                                         pippenger_runtime_state<Curve>& state,
+                                         bool handle_edge_cases,
+                                         std::vector<std::array<size_t, NUM_SCALAR_CATEGORIES>> thread_counts)
+{
+    using Element = typename Curve::Element;
+
+    const size_t num_threads = thread_counts.size();
+    const size_t scalars_per_thread = (num_initial_points + num_threads - 1) / num_threads;
+
+    // Per-thread write offsets into the index arrays of each category, which are laid out back to back.
+    std::array<size_t, NUM_SCALAR_CATEGORIES> running{};
+    for (auto& offsets : thread_counts) {
+        for (size_t k = 0; k < NUM_SCALAR_CATEGORIES; ++k) {
+            const size_t thread_count = offsets[k];
+            offsets[k] = running[k];
+            running[k] += thread_count;
+        }
+    }
+    std::vector<uint32_t> point_indices(running[SMALL_SCALAR] + running[FULL_SCALAR]);
+    uint32_t* small_indices = point_indices.data();
+    uint32_t* full_indices = small_indices + running[SMALL_SCALAR];
+    std::vector<Element> thread_one_sums(num_threads);
+
+    parallel_for(num_threads, [&](size_t j) {
+        auto offsets = thread_counts[j];
+        Element& one_sum = thread_one_sums[j];
+        one_sum.self_set_infinity();
+        const size_t start = std::min(j * scalars_per_thread, num_initial_points);
+        const size_t end = std::min(start + scalars_per_thread, num_initial_points);
+        for (size_t i = start; i < end; ++i) {
+            switch (get_scalar_category(scalars[i])) {
+            case ONE_SCALAR: {
+                one_sum += points[i * 2];
+                break;
+            }
+            case SMALL_SCALAR: {
+                small_indices[offsets[SMALL_SCALAR]++] = static_cast<uint32_t>(i);
+                break;
+            }
+            case FULL_SCALAR: {
+                full_indices[offsets[FULL_SCALAR]++] = static_cast<uint32_t>(i);
+                break;
+            }
+            default: {
+            }
+            }
+        }
+    });
+
+    Element result;
+    result.self_set_infinity();
+    for (const auto& one_sum : thread_one_sums) {
+        result += one_sum;
+    }
+    result += pippenger_of_indices(scalars, points, small_indices, running[SMALL_SCALAR], state, handle_edge_cases);
+    result += pippenger_of_indices(scalars, points, full_indices, running[FULL_SCALAR], state, handle_edge_cases);
+    return result;
+}
+
+/**
+ * The msm of the scalars and points at `point_indices`, or of the first `num_initial_points` ones if there are none,
+ * without the sparse-scalar pre-pass.
+ **/
+template <typename Curve>
+typename Curve::Element pippenger_of_indices(typename Curve::ScalarField* scalars,
+                                             typename Curve::AffineElement* points,
+                                             const uint32_t* point_indices,
+                                             const size_t num_initial_points,
+                                             pippenger_runtime_state<Curve>& state,
+                                             bool handle_edge_cases)
 {
     using Group = typename Curve::Group;
     using Element = typename Curve::Element;
@@ -895,8 +1194,10 @@ typename Curve::Element pippenger(typename Curve::ScalarField* scalars,
         std::vector<Element> exponentiation_results(num_initial_points);
         // might as well multithread this...
         // Possible optimization: use group::batch_mul_with_endomorphism here.
-        parallel_for(num_initial_points,
-                     [&](size_t i) { exponentiation_results[i] = Element(points[i * 2]) * scalars[i]; });
+        parallel_for(num_initial_points, [&](size_t i) {
+            const size_t point_index = point_indices == nullptr ? i : point_indices[i];
+            exponentiation_results[i] = Element(points[point_index * 2]) * scalars[point_index];
+        });
 
         for (size_t i = num_initial_points - 1; i > 0; --i) {
             exponentiation_results[i - 1] += exponentiation_results[i];
@@ -907,17 +1208,88 @@ typename Curve::Element pippenger(typename Curve::ScalarField* scalars,
     const auto slice_bits = static_cast<size_t>(numeric::get_msb(static_cast<uint64_t>(num_initial_points)));
     const auto num_slice_points = static_cast<size_t>(1ULL << slice_bits);
 
-    Element result = pippenger_internal(points, scalars, num_slice_points, state, handle_edge_cases);
+    std::array<uint64_t*, 1> point_schedules{ state.point_schedule };
+    std::array<bool*, 1> skew_tables{ state.skew_table };
+    std::array<uint64_t*, 1> round_counts{ state.round_counts };
+    std::array<const typename Curve::ScalarField*, 1> slice_scalars{ scalars };
+    compute_wnaf_states_of_indices<Curve>(
+        point_schedules, skew_tables, round_counts, slice_scalars, point_indices, num_slice_points);
+    organize_buckets(state.point_schedule, num_slice_points * 2);
+    Element result = evaluate_pippenger_rounds_of_indices<Curve>(state,
+                                                                 point_schedules,
+                                                                 skew_tables,
+                                                                 round_counts,
+                                                                 points,
+                                                                 point_indices,
+                                                                 num_slice_points * 2,
+                                                                 handle_edge_cases)[0];
+
+    if (num_slice_points == num_initial_points) {
+        return result;
+    }
+    const size_t leftover_points = num_initial_points - num_slice_points;
+    if (point_indices != nullptr) {
+        return result + pippenger_of_indices(scalars,
+                                             points,
+                                             point_indices + num_slice_points,
+                                             leftover_points,
+                                             state,
+                                             handle_edge_cases);
+    }
+    return result + pippenger_of_indices(scalars + num_slice_points,
+                                         points + num_slice_points * 2,
+                                         nullptr,
+                                         leftover_points,
+                                         state,
+                                         handle_edge_cases);
+}
 
-    if (num_slice_points != num_initial_points) {
-        const uint64_t leftover_points = num_initial_points - num_slice_points;
-        return result + pippenger(scalars + num_slice_points,
-                                  points + static_cast<size_t>(num_slice_points * 2),
-                                  static_cast<size_t>(leftover_points),
-                                  state,
-                                  handle_edge_cases);
+/**
+ * Pippenger's algorithm without the sparse-scalar pre-pass. Use this when the scalars are known to be uniformly
+ * distributed (e.g. randomly blinded or quotient polynomials in monomial form), to skip the classification scan.
+ **/
+template <typename Curve>
+typename Curve::Element pippenger_dense(typename Curve::ScalarField* scalars,
+                                        typename Curve::AffineElement* points,
+                                        const size_t num_initial_points,
+                                        pippenger_runtime_state<Curve>& state,
+                                        bool handle_edge_cases)
+{
+    return pippenger_of_indices(scalars, points, nullptr, num_initial_points, state, handle_edge_cases);
+}
+
+/**
+ * Sum the counts of `classify_scalars` of each thread.
+ **/
+std::array<size_t, NUM_SCALAR_CATEGORIES> sum_counts(
+    const std::vector<std::array<size_t, NUM_SCALAR_CATEGORIES>>& thread_counts)
+{
+    std::array<size_t, NUM_SCALAR_CATEGORIES> counts{};
+    for (const auto& thread_count : thread_counts) {
+        for (size_t k = 0; k < NUM_SCALAR_CATEGORIES; ++k) {
+            counts[k] += thread_count[k];
+        }
     }
-    return result;
+    return counts;
+}
+
+template <typename Curve>
+typename Curve::Element pippenger(typename Curve::ScalarField* scalars,
+                                  typename Curve::AffineElement* points,
+                                  const size_t num_initial_points,
+                                  pippenger_runtime_state<Curve>& state,
+                                  bool handle_edge_cases)
+{
+    const size_t threshold = get_num_cpus_pow2() * 8;
+    if (num_initial_points <= threshold || is_clearly_dense<Curve>(scalars, num_initial_points)) {
+        return pippenger_dense(scalars, points, num_initial_points, state, handle_edge_cases);
+    }
+
+    auto thread_counts = classify_scalars<Curve>(scalars, num_initial_points, get_num_cpus_pow2());
+    if (is_dense(sum_counts(thread_counts), num_initial_points)) {
+        return pippenger_dense(scalars, points, num_initial_points, state, handle_edge_cases);
+    }
+    return pippenger_sparse(scalars, points, num_initial_points, state, handle_edge_cases, std::move(thread_counts));
 }
 
 /**
@@ -955,6 +1327,144 @@ typename Curve::Element pippenger_without_endomorphism_basis_points(typename Cur
     return pippenger(scalars, &G_mod[0], num_initial_points, state, false);
 }
 
+/**
+ * Compute several multi-scalar-multiplications of the same size against one pippenger point table.
+ *
+ * Prover rounds typically commit to a handful of polynomials at once (e.g. the wires), and calling `pippenger` once per
+ * polynomial repeats the wnaf computation fan-out, the bucket sort fan-out and a full streaming pass over the point
+ * table for every msm. Here the msms are processed in tiles of up to `MAX_PIPPENGER_BATCH_SIZE`: the wnaf states,
+ * bucket sorting and round evaluation of a tile each use a single thread fan-out, and the round evaluation interleaves
+ * the msms of the tile so that point table accesses are shared (see `evaluate_pippenger_rounds_batch`). Msms whose
+ * scalars are mostly zero, one or small are instead evaluated individually by the sparse path of `pippenger`.
+ *
+ * The first msm of a tile uses the buffers of `state`, the remaining ones use point schedules allocated for the
+ * duration of the call. `state` must have been constructed for at least `num_initial_points` points.
+ *
+ * @param scalars One pointer per msm, each to `num_initial_points` scalar multipliers
+ * @param points The pippenger point table (see `generate_pippenger_point_table`)
+ * @param num_initial_points The number of points (before the endomorphism split) of every msm
+ * @return The result of each msm, in the order of `scalars`
+ **/
+template <typename Curve>
+std::vector<typename Curve::Element> pippenger_batch(std::span<typename Curve::ScalarField*> scalars,
+                                                     typename Curve::AffineElement* points,
+                                                     const size_t num_initial_points,
+                                                     pippenger_runtime_state<Curve>& state,
+                                                     bool handle_edge_cases)
+{
+    using Fr = typename Curve::ScalarField;
+    using Element = typename Curve::Element;
+
+    const size_t batch_size = scalars.size();
+    std::vector<Element> results(batch_size);
+    for (auto& result : results) {
+        result.self_set_infinity();
+    }
+
+    // below the threshold `pippenger` falls back to per-point scalar multiplications, there is nothing to share.
+    const size_t threshold = get_num_cpus_pow2() * 8;
+    if (batch_size == 1 || num_initial_points <= threshold) {
+        for (size_t k = 0; k < batch_size; ++k) {
+            results[k] = pippenger(scalars[k], points, num_initial_points, state, handle_edge_cases);
+        }
+        return results;
+    }
+
+    // Msms with mostly zero, unit or small scalars take the sparse path individually, the rest are batched.
+    std::vector<size_t> dense_indices;
+    for (size_t k = 0; k < batch_size; ++k) {
+        if (is_clearly_dense<Curve>(scalars[k], num_initial_points)) {
+            dense_indices.push_back(k);
+            continue;
+        }
+        auto thread_counts = classify_scalars<Curve>(scalars[k], num_initial_points, get_num_cpus_pow2());
+        if (is_dense(sum_counts(thread_counts), num_initial_points)) {
+            dense_indices.push_back(k);
+        } else {
+            results[k] = pippenger_sparse(
+                scalars[k], points, num_initial_points, state, handle_edge_cases, std::move(thread_counts));
+        }
+    }
+    const size_t num_dense = dense_indices.size();
+    if (num_dense == 0) {
+        return results;
+    }
+
+    // Scratch space for the tile members that cannot use the buffers in `state`. Sized for the largest slice.
+    const auto max_slice_points =
+        static_cast<size_t>(1ULL << numeric::get_msb(static_cast<uint64_t>(num_initial_points)));
+    const size_t max_tile_size = std::min(num_dense, MAX_PIPPENGER_BATCH_SIZE);
+    const size_t schedule_size = get_point_schedule_size(max_slice_points) + state.prefetch_overflow;
+    std::vector<std::shared_ptr<void>> schedule_slabs;
+    std::vector<std::vector<uint64_t>> tile_round_counts(max_tile_size, std::vector<uint64_t>(state.MAX_NUM_ROUNDS, 0));
+    std::vector<uint64_t*> tile_point_schedules{ state.point_schedule };
+    std::vector<bool*> tile_skew_tables{ state.skew_table };
+    std::vector<uint64_t*> tile_round_count_ptrs{ state.round_counts };
+    std::vector<std::unique_ptr<bool[], decltype(&aligned_free)>> skew_storage;
+    for (size_t k = 1; k < max_tile_size; ++k) {
+        schedule_slabs.emplace_back(get_mem_slab(schedule_size * sizeof(uint64_t)));
+        skew_storage.emplace_back(static_cast<bool*>(aligned_alloc(64, pad(max_slice_points * 2 * sizeof(bool), 64))),
+                                  &aligned_free);
+        tile_point_schedules.push_back(static_cast<uint64_t*>(schedule_slabs.back().get()));
+        tile_skew_tables.push_back(skew_storage.back().get());
+        tile_round_count_ptrs.push_back(tile_round_counts[k].data());
+    }
+
+    for (size_t tile_start = 0; tile_start < num_dense; tile_start += max_tile_size) {
+        const size_t tile_size = std::min(max_tile_size, num_dense - tile_start);
+        std::span<uint64_t*> point_schedules(tile_point_schedules.data(), tile_size);
+        std::span<bool*> skew_tables(tile_skew_tables.data(), tile_size);
+        std::span<uint64_t*> round_counts(tile_round_count_ptrs.data(), tile_size);
+        std::vector<const Fr*> tile_scalars(tile_size);
+
+        // Mirror `pippenger`: evaluate power-of-two slices with the full algorithm, then handle the remainder.
+        size_t offset = 0;
+        while (num_initial_points - offset > threshold) {
+            const auto slice_points = static_cast<size_t>(
+                1ULL << numeric::get_msb(static_cast<uint64_t>(num_initial_points - offset)));
+            for (size_t k = 0; k < tile_size; ++k) {
+                tile_scalars[k] = scalars[dense_indices[tile_start + k]] + offset;
+            }
+            compute_wnaf_states_batch<Curve>(point_schedules, skew_tables, round_counts, tile_scalars, slice_points);
+            organize_buckets_batch(point_schedules, slice_points * 2);
+            std::vector<Element> slice_results = evaluate_pippenger_rounds_batch<Curve>(state,
+                                                                                        point_schedules,
+                                                                                        skew_tables,
+                                                                                        round_counts,
+                                                                                        points + offset * 2,
+                                                                                        slice_points * 2,
+                                                                                        handle_edge_cases);
+            for (size_t k = 0; k < tile_size; ++k) {
+                results[dense_indices[tile_start + k]] += slice_results[k];
+            }
+            offset += slice_points;
+        }
+        if (offset != num_initial_points) {
+            for (size_t k = 0; k < tile_size; ++k) {
+                const size_t msm_index = dense_indices[tile_start + k];
+                results[msm_index] += pippenger_dense(scalars[msm_index] + offset,
+                                                      points + offset * 2,
+                                                      num_initial_points - offset,
+                                                      state,
+                                                      handle_edge_cases);
+            }
+        }
+    }
+    return results;
+}
+
+/**
+ * `pippenger_batch` using the affine-addition formulae without edge-case handling. See `pippenger_unsafe`.
+ **/
+template <typename Curve>
+std::vector<typename Curve::Element> pippenger_batch_unsafe(std::span<typename Curve::ScalarField*> scalars,
+                                                            typename Curve::AffineElement* points,
+                                                            const size_t num_initial_points,
+                                                            pippenger_runtime_state<Curve>& state)
+{
+    return pippenger_batch(scalars, points, num_initial_points, state, false);
+}
+
 // Explicit instantiation
 // BN254
 template void generate_pippenger_point_table<curve::BN254>(curve::BN254::AffineElement* points,
@@ -996,6 +1506,12 @@ template curve::BN254::Element pippenger<curve::BN254>(curve::BN254::ScalarField
                                                        pippenger_runtime_state<curve::BN254>& state,
                                                        bool handle_edge_cases = true);
 
+template curve::BN254::Element pippenger_dense<curve::BN254>(curve::BN254::ScalarField* scalars,
+                                                             curve::BN254::AffineElement* points,
+                                                             const size_t num_initial_points,
+                                                             pippenger_runtime_state<curve::BN254>& state,
+                                                             bool handle_edge_cases);
+
 template curve::BN254::Element pippenger_unsafe<curve::BN254>(curve::BN254::ScalarField* scalars,
                                                               curve::BN254::AffineElement* points,
                                                               const size_t num_initial_points,
@@ -1007,6 +1523,40 @@ template curve::BN254::Element pippenger_without_endomorphism_basis_points<curve
     const size_t num_initial_points,
     pippenger_runtime_state<curve::BN254>& state);
 
+template void compute_wnaf_states<curve::BN254>(uint64_t* point_schedule,
+                                                bool* input_skew_table,
+                                                uint64_t* round_counts,
+                                                const curve::BN254::ScalarField* scalars,
+                                                const size_t num_initial_points);
+
+template void compute_wnaf_states_batch<curve::BN254>(std::span<uint64_t*> point_schedules,
+                                                      std::span<bool*> input_skew_tables,
+                                                      std::span<uint64_t*> round_counts,
+                                                      std::span<const curve::BN254::ScalarField*> scalars,
+                                                      const size_t num_initial_points);
+
+template std::vector<curve::BN254::Element> evaluate_pippenger_rounds_batch<curve::BN254>(
+    pippenger_runtime_state<curve::BN254>& state,
+    std::span<uint64_t*> point_schedules,
+    std::span<bool*> skew_tables,
+    std::span<uint64_t*> round_counts,
+    curve::BN254::AffineElement* points,
+    const size_t num_points,
+    bool handle_edge_cases);
+
+template std::vector<curve::BN254::Element> pippenger_batch<curve::BN254>(
+    std::span<curve::BN254::ScalarField*> scalars,
+    curve::BN254::AffineElement* points,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::BN254>& state,
+    bool handle_edge_cases);
+
+template std::vector<curve::BN254::Element> pippenger_batch_unsafe<curve::BN254>(
+    std::span<curve::BN254::ScalarField*> scalars,
+    curve::BN254::AffineElement* points,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::BN254>& state);
+
 // Grumpkin
 template void generate_pippenger_point_table<curve::Grumpkin>(curve::Grumpkin::AffineElement* points,
                                                               curve::Grumpkin::AffineElement* table,
@@ -1047,6 +1597,13 @@ template curve::Grumpkin::Element pippenger<curve::Grumpkin>(curve::Grumpkin::Sc
                                                              pippenger_runtime_state<curve::Grumpkin>& state,
                                                              bool handle_edge_cases = true);
 
+template curve::Grumpkin::Element pippenger_dense<curve::Grumpkin>(
+    curve::Grumpkin::ScalarField* scalars,
+    curve::Grumpkin::AffineElement* points,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::Grumpkin>& state,
+    bool handle_edge_cases);
+
 template curve::Grumpkin::Element pippenger_unsafe<curve::Grumpkin>(curve::Grumpkin::ScalarField* scalars,
                                                                     curve::Grumpkin::AffineElement* points,
                                                                     const size_t num_initial_points,
@@ -1058,6 +1615,40 @@ template curve::Grumpkin::Element pippenger_without_endomorphism_basis_points<cu
     const size_t num_initial_points,
     pippenger_runtime_state<curve::Grumpkin>& state);
 
+template void compute_wnaf_states<curve::Grumpkin>(uint64_t* point_schedule,
+                                                   bool* input_skew_table,
+                                                   uint64_t* round_counts,
+                                                   const curve::Grumpkin::ScalarField* scalars,
+                                                   const size_t num_initial_points);
+
+template void compute_wnaf_states_batch<curve::Grumpkin>(std::span<uint64_t*> point_schedules,
+                                                      std::span<bool*> input_skew_tables,
+                                                      std::span<uint64_t*> round_counts,
+                                                      std::span<const curve::Grumpkin::ScalarField*> scalars,
+                                                      const size_t num_initial_points);
+
+template std::vector<curve::Grumpkin::Element> evaluate_pippenger_rounds_batch<curve::Grumpkin>(
+    pippenger_runtime_state<curve::Grumpkin>& state,
+    std::span<uint64_t*> point_schedules,
+    std::span<bool*> skew_tables,
+    std::span<uint64_t*> round_counts,
+    curve::Grumpkin::AffineElement* points,
+    const size_t num_points,
+    bool handle_edge_cases);
+
+template std::vector<curve::Grumpkin::Element> pippenger_batch<curve::Grumpkin>(
+    std::span<curve::Grumpkin::ScalarField*> scalars,
+    curve::Grumpkin::AffineElement* points,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::Grumpkin>& state,
+    bool handle_edge_cases);
+
+template std::vector<curve::Grumpkin::Element> pippenger_batch_unsafe<curve::Grumpkin>(
+    std::span<curve::Grumpkin::ScalarField*> scalars,
+    curve::Grumpkin::AffineElement* points,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::Grumpkin>& state);
+
 } // namespace barretenberg::scalar_multiplication
 
 // NOLINTEND(cppcoreguidelines-avoid-c-arrays, google-readability-casting)
@@ -5,9 +5,15 @@
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include <cstddef>
 #include <cstdint>
+#include <span>
+#include <vector>
 
 namespace barretenberg::scalar_multiplication {
 
+// The maximum number of multi-scalar-multiplications that `pippenger_batch` evaluates together. Each additional msm in
+// a tile needs its own point schedule, so this bounds the extra memory used by batching.
+constexpr size_t MAX_PIPPENGER_BATCH_SIZE = 4;
+
 constexpr size_t get_num_buckets(const size_t num_points)
 {
     const size_t bits_per_bucket = get_optimal_bucket_width(num_points / 2);
@@ -92,6 +98,13 @@ void compute_wnaf_states(uint64_t* point_schedule,
                          const typename Curve::ScalarField* scalars,
                          size_t num_initial_points);
 
+template <typename Curve>
+void compute_wnaf_states_batch(std::span<uint64_t*> point_schedules,
+                               std::span<bool*> input_skew_tables,
+                               std::span<uint64_t*> round_counts,
+                               std::span<const typename Curve::ScalarField*> scalars,
+                               size_t num_initial_points);
+
 template <typename Curve>
 void generate_pippenger_point_table(typename Curve::AffineElement* points,
                                     typename Curve::AffineElement* table,
@@ -99,6 +112,8 @@ void generate_pippenger_point_table(typename Curve::AffineElement* points,
 
 void organize_buckets(uint64_t* point_schedule, size_t num_points);
 
+void organize_buckets_batch(std::span<uint64_t*> point_schedules, size_t num_points);
+
 inline void count_bits(const uint32_t* bucket_counts,
                        uint32_t* bit_offsets,
                        const uint32_t num_buckets,
@@ -146,6 +161,15 @@ typename Curve::Element evaluate_pippenger_rounds(pippenger_runtime_state<Curve>
                                                   size_t num_points,
                                                   bool handle_edge_cases = false);
 
+template <typename Curve>
+std::vector<typename Curve::Element> evaluate_pippenger_rounds_batch(pippenger_runtime_state<Curve>& state,
+                                                                     std::span<uint64_t*> point_schedules,
+                                                                     std::span<bool*> skew_tables,
+                                                                     std::span<uint64_t*> round_counts,
+                                                                     typename Curve::AffineElement* points,
+                                                                     size_t num_points,
+                                                                     bool handle_edge_cases = false);
+
 template <typename Curve>
 typename Curve::AffineElement* reduce_buckets(affine_product_runtime_state<Curve>& state,
                                               bool first_round = true,
@@ -158,6 +182,13 @@ typename Curve::Element pippenger(typename Curve::ScalarField* scalars,
                                   pippenger_runtime_state<Curve>& state,
                                   bool handle_edge_cases = true);
 
+template <typename Curve>
+typename Curve::Element pippenger_dense(typename Curve::ScalarField* scalars,
+                                        typename Curve::AffineElement* points,
+                                        size_t num_initial_points,
+                                        pippenger_runtime_state<Curve>& state,
+                                        bool handle_edge_cases = true);
+
 template <typename Curve>
 typename Curve::Element pippenger_unsafe(typename Curve::ScalarField* scalars,
                                          typename Curve::AffineElement* points,
@@ -170,6 +201,19 @@ typename Curve::Element pippenger_without_endomorphism_basis_points(typename Cur
                                                                     size_t num_initial_points,
                                                                     pippenger_runtime_state<Curve>& state);
 
+template <typename Curve>
+std::vector<typename Curve::Element> pippenger_batch(std::span<typename Curve::ScalarField*> scalars,
+                                                     typename Curve::AffineElement* points,
+                                                     size_t num_initial_points,
+                                                     pippenger_runtime_state<Curve>& state,
+                                                     bool handle_edge_cases = true);
+
+template <typename Curve>
+std::vector<typename Curve::Element> pippenger_batch_unsafe(std::span<typename Curve::ScalarField*> scalars,
+                                                            typename Curve::AffineElement* points,
+                                                            size_t num_initial_points,
+                                                            pippenger_runtime_state<Curve>& state);
+
 // Explicit instantiation
 // BN254
 
@@ -212,6 +256,12 @@ extern template curve::BN254::Element pippenger<curve::BN254>(curve::BN254::Scal
                                                               pippenger_runtime_state<curve::BN254>& state,
                                                               bool handle_edge_cases = true);
 
+extern template curve::BN254::Element pippenger_dense<curve::BN254>(curve::BN254::ScalarField* scalars,
+                                                                    curve::BN254::AffineElement* points,
+                                                                    const size_t num_initial_points,
+                                                                    pippenger_runtime_state<curve::BN254>& state,
+                                                                    bool handle_edge_cases = true);
+
 extern template curve::BN254::Element pippenger_unsafe<curve::BN254>(curve::BN254::ScalarField* scalars,
                                                                      curve::BN254::AffineElement* points,
                                                                      const size_t num_initial_points,
@@ -223,6 +273,28 @@ extern template curve::BN254::Element pippenger_without_endomorphism_basis_point
     const size_t num_initial_points,
     pippenger_runtime_state<curve::BN254>& state);
 
+extern template std::vector<curve::BN254::Element> evaluate_pippenger_rounds_batch<curve::BN254>(
+    pippenger_runtime_state<curve::BN254>& state,
+    std::span<uint64_t*> point_schedules,
+    std::span<bool*> skew_tables,
+    std::span<uint64_t*> round_counts,
+    curve::BN254::AffineElement* points,
+    const size_t num_points,
+    bool handle_edge_cases = false);
+
+extern template std::vector<curve::BN254::Element> pippenger_batch<curve::BN254>(
+    std::span<curve::BN254::ScalarField*> scalars,
+    curve::BN254::AffineElement* points,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::BN254>& state,
+    bool handle_edge_cases = true);
+
+extern template std::vector<curve::BN254::Element> pippenger_batch_unsafe<curve::BN254>(
+    std::span<curve::BN254::ScalarField*> scalars,
+    curve::BN254::AffineElement* points,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::BN254>& state);
+
 // Grumpkin
 
 extern template void generate_pippenger_point_table<curve::Grumpkin>(curve::Grumpkin::AffineElement* points,
@@ -265,6 +337,13 @@ extern template curve::Grumpkin::Element pippenger<curve::Grumpkin>(curve::Grump
                                                                     pippenger_runtime_state<curve::Grumpkin>& state,
                                                                     bool handle_edge_cases = true);
 
+extern template curve::Grumpkin::Element pippenger_dense<curve::Grumpkin>(
+    curve::Grumpkin::ScalarField* scalars,
+    curve::Grumpkin::AffineElement* points,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::Grumpkin>& state,
+    bool handle_edge_cases = true);
+
 extern template curve::Grumpkin::Element pippenger_unsafe<curve::Grumpkin>(
     curve::Grumpkin::ScalarField* scalars,
     curve::Grumpkin::AffineElement* points,
@@ -277,4 +356,26 @@ extern template curve::Grumpkin::Element pippenger_without_endomorphism_basis_po
     const size_t num_initial_points,
     pippenger_runtime_state<curve::Grumpkin>& state);
 
+extern template std::vector<curve::Grumpkin::Element> evaluate_pippenger_rounds_batch<curve::Grumpkin>(
+    pippenger_runtime_state<curve::Grumpkin>& state,
+    std::span<uint64_t*> point_schedules,
+    std::span<bool*> skew_tables,
+    std::span<uint64_t*> round_counts,
+    curve::Grumpkin::AffineElement* points,
+    const size_t num_points,
+    bool handle_edge_cases = false);
+
+extern template std::vector<curve::Grumpkin::Element> pippenger_batch<curve::Grumpkin>(
+    std::span<curve::Grumpkin::ScalarField*> scalars,
+    curve::Grumpkin::AffineElement* points,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::Grumpkin>& state,
+    bool handle_edge_cases = true);
+
+extern template std::vector<curve::Grumpkin::Element> pippenger_batch_unsafe<curve::Grumpkin>(
+    std::span<curve::Grumpkin::ScalarField*> scalars,
+    curve::Grumpkin::AffineElement* points,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::Grumpkin>& state);
+
 } // namespace barretenberg::scalar_multiplication
@@ -16,6 +16,17 @@ std::shared_ptr<ProverInstance_<Flavor>> UltraComposer_<Flavor>::create_instance
     return instance;
 }
 
+template <UltraFlavor Flavor>
+std::shared_ptr<ProverInstance_<Flavor>> UltraComposer_<Flavor>::create_instance(
+    CircuitBuilder& circuit, std::shared_ptr<typename Flavor::ProvingKey> proving_key)
+{
+    circuit.add_gates_to_ensure_all_polys_are_non_zero();
+    circuit.finalize_circuit();
+    auto instance = std::make_shared<Instance>(circuit, std::move(proving_key));
+    instance->commitment_key = compute_commitment_key(instance->proving_key->circuit_size);
+    return instance;
+}
+
 template <UltraFlavor Flavor>
 UltraProver_<Flavor> UltraComposer_<Flavor>::create_prover(std::shared_ptr<Instance> instance)
 {
@@ -71,6 +71,12 @@ template <UltraFlavor Flavor> class UltraComposer_ {
 
     std::shared_ptr<Instance> create_instance(CircuitBuilder& circuit);
 
+    /**
+     * @brief Create an instance reusing the precomputed polynomials of a proving key of the circuit, e.g. one read with
+     * read_proving_key_file
+     */
+    std::shared_ptr<Instance> create_instance(CircuitBuilder& circuit, std::shared_ptr<ProvingKey> proving_key);
+
     UltraProver_<Flavor> create_prover(std::shared_ptr<Instance>);
     UltraVerifier_<Flavor> create_verifier(std::shared_ptr<Instance>);
 
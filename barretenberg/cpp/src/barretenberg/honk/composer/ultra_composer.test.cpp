@@ -5,11 +5,13 @@
 #include "barretenberg/honk/utils/grand_product_delta.hpp"
 #include "barretenberg/numeric/uint256/uint256.hpp"
 #include "barretenberg/proof_system/circuit_builder/ultra_circuit_builder.hpp"
+#include "barretenberg/proof_system/flavor/proving_key_file.hpp"
 #include "barretenberg/proof_system/plookup_tables/types.hpp"
 #include "barretenberg/proof_system/relations/permutation_relation.hpp"
 #include "barretenberg/proof_system/relations/relation_parameters.hpp"
 #include <cstddef>
 #include <cstdint>
+#include <filesystem>
 #include <gtest/gtest.h>
 #include <string>
 #include <vector>
@@ -116,6 +118,43 @@ TEST_F(UltraHonkComposerTests, PublicInputs)
     prove_and_verify(builder, composer, /*expected_result=*/true);
 }
 
+/**
+ * @brief Test that a proving key written to a file can be mapped and used to prove a circuit of the same structure
+ *
+ */
+TEST_F(UltraHonkComposerTests, ProvingKeyFromFile)
+{
+    auto create_circuit = []() {
+        auto builder = proof_system::UltraCircuitBuilder();
+        for (size_t i = 0; i < 10; ++i) {
+            fr a = fr::random_element();
+            fr b = fr::random_element();
+            uint32_t a_idx = builder.add_public_variable(a);
+            uint32_t b_idx = builder.add_variable(b);
+            uint32_t c_idx = builder.add_variable(a * b);
+            builder.create_mul_gate({ a_idx, b_idx, c_idx, fr(1), fr(-1), fr(0) });
+        }
+        return builder;
+    };
+
+    auto composer = UltraComposer();
+    auto builder = create_circuit();
+    auto instance = composer.create_instance(builder);
+    const std::string path = std::filesystem::temp_directory_path() / "ultra_honk_proving_key";
+    flavor::write_proving_key_file(path, *instance->proving_key);
+
+    // A circuit of the same structure, with different witnesses
+    auto mapped_key = flavor::read_proving_key_file<flavor::Ultra::ProvingKey>(path);
+    std::filesystem::remove(path);
+    auto other_builder = create_circuit();
+    auto mapped_instance = composer.create_instance(other_builder, mapped_key);
+
+    auto prover = composer.create_prover(mapped_instance);
+    auto verifier = composer.create_verifier(instance);
+    auto proof = prover.construct_proof();
+    EXPECT_TRUE(verifier.verify_proof(proof));
+}
+
 TEST_F(UltraHonkComposerTests, XorConstraint)
 {
     auto circuit_builder = proof_system::UltraCircuitBuilder();
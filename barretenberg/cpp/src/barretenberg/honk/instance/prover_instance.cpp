@@ -50,6 +50,8 @@ template <class Flavor> void ProverInstance_<Flavor>::compute_witness(Circuit& c
         return;
     }
 
+    barretenberg::ProofArena::Scope arena_scope(proving_key->arena.get());
+
     // Construct the conventional wire polynomials
     auto wire_polynomials = construct_wire_polynomials_base<Flavor>(circuit, dyadic_circuit_size);
 
@@ -193,6 +195,7 @@ std::shared_ptr<typename Flavor::ProvingKey> ProverInstance_<Flavor>::compute_pr
     // Compute lagrange selectors
 
     proving_key = std::make_shared<ProvingKey>(dyadic_circuit_size, num_public_inputs);
+    barretenberg::ProofArena::Scope arena_scope(proving_key->arena.get());
 
     construct_selector_polynomials<Flavor>(circuit, proving_key.get());
 
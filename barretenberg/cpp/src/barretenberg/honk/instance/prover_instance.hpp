@@ -52,6 +52,21 @@ template <class Flavor> class ProverInstance_ {
         compute_witness(circuit);
     }
 
+    /**
+     * @brief Create an instance of a circuit whose precomputed polynomials are already known, e.g. from a proving key
+     * read with read_proving_key_file, computing only the witness polynomials
+     */
+    ProverInstance_(Circuit& circuit, std::shared_ptr<ProvingKey> precomputed_key)
+        : proving_key(std::move(precomputed_key))
+    {
+        compute_circuit_size_parameters(circuit);
+        ASSERT(proving_key->circuit_size == dyadic_circuit_size);
+        if constexpr (IsGoblinFlavor<Flavor>) {
+            proving_key->num_ecc_op_gates = num_ecc_op_gates;
+        }
+        compute_witness(circuit);
+    }
+
     ProverInstance_(FoldingResult<Flavor> result)
         : verification_key(std::move(result.verification_key))
         , prover_polynomials(result.folded_prover_polynomials)
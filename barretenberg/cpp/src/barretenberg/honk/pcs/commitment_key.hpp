@@ -17,9 +17,11 @@
 #include "barretenberg/srs/factories/crs_factory.hpp"
 #include "barretenberg/srs/factories/file_crs_factory.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 #include <string_view>
+#include <vector>
 
 namespace proof_system::honk::pcs {
 
@@ -71,6 +73,57 @@ template <class Curve> class CommitmentKey {
             const_cast<Fr*>(polynomial.data()), srs->get_monomial_points(), degree, pippenger_runtime_state);
     };
 
+    /**
+     * @brief Commit to several polynomials with batched multi-scalar-multiplications
+     *
+     * @details The polynomials may be of different sizes, e.g. the geometrically shrinking Gemini fold polynomials. With
+     * s₁ < s₂ < ... < sₘ the distinct sizes of the polynomials, the SRS points in [sⱼ₋₁, sⱼ) are used by every
+     * polynomial of size at least sⱼ. The contributions of those polynomials to their commitments are computed together,
+     * by one pippenger_batch over that range of points, and added up for each polynomial. Each range of points is hence
+     * read once, with one thread fan-out per stage of pippenger, however many polynomials use it.
+     *
+     * @param polynomials univariate polynomials pₖ(X)
+     * @return Commitments Cₖ = [pₖ(x)], in the order of `polynomials`
+     */
+    std::vector<Commitment> batch_commit(std::span<const std::span<const Fr>> polynomials)
+    {
+        std::vector<size_t> sizes;
+        sizes.reserve(polynomials.size());
+        for (const auto& polynomial : polynomials) {
+            sizes.push_back(polynomial.size());
+        }
+        std::sort(sizes.begin(), sizes.end());
+        sizes.erase(std::unique(sizes.begin(), sizes.end()), sizes.end());
+        ASSERT(sizes.empty() || sizes.back() <= srs->get_monomial_size());
+
+        std::vector<typename Curve::Element> results(polynomials.size());
+        for (auto& result : results) {
+            result.self_set_infinity();
+        }
+        size_t range_start = 0;
+        for (const size_t range_end : sizes) {
+            if (range_end == range_start) {
+                continue;
+            }
+            std::vector<size_t> indices;
+            std::vector<Fr*> scalars;
+            for (size_t k = 0; k < polynomials.size(); ++k) {
+                if (polynomials[k].size() >= range_end) {
+                    indices.push_back(k);
+                    scalars.push_back(const_cast<Fr*>(polynomials[k].data()) + range_start);
+                }
+            }
+            // The pippenger point table holds two points per SRS point, see generate_pippenger_point_table
+            auto range_results = barretenberg::scalar_multiplication::pippenger_batch_unsafe<Curve>(
+                scalars, srs->get_monomial_points() + 2 * range_start, range_end - range_start, pippenger_runtime_state);
+            for (size_t j = 0; j < indices.size(); ++j) {
+                results[indices[j]] += range_results[j];
+            }
+            range_start = range_end;
+        }
+        return { results.begin(), results.end() };
+    };
+
     barretenberg::scalar_multiplication::pippenger_runtime_state<Curve> pippenger_runtime_state;
     std::shared_ptr<barretenberg::srs::factories::ProverCrs<Curve>> srs;
 };
@@ -24,6 +24,26 @@ template <class Curve> class KZGTest : public CommitmentTest<Curve> {
 
 TYPED_TEST_SUITE(KZGTest, CommitmentSchemeParams);
 
+// Polynomials of different sizes, as the Gemini fold polynomials, share the multi-scalar-multiplications of the points
+// they have in common
+TYPED_TEST(KZGTest, BatchCommitMixedSizes)
+{
+    using Fr = typename TypeParam::ScalarField;
+    using Polynomial = typename TestFixture::Polynomial;
+
+    std::vector<Polynomial> polynomials;
+    for (size_t size : std::vector<size_t>{ 256, 128, 100, 128, 64, 8, 2 }) {
+        polynomials.push_back(this->random_polynomial(size));
+    }
+    std::vector<std::span<const Fr>> spans(polynomials.begin(), polynomials.end());
+    auto commitments = this->ck()->batch_commit(spans);
+
+    ASSERT_EQ(commitments.size(), polynomials.size());
+    for (size_t i = 0; i < polynomials.size(); ++i) {
+        EXPECT_EQ(commitments[i], this->commit(polynomials[i]));
+    }
+}
+
 TYPED_TEST(KZGTest, single)
 {
     const size_t n = 16;
@@ -49,6 +69,34 @@ TYPED_TEST(KZGTest, single)
     EXPECT_EQ(verified, true);
 }
 
+TYPED_TEST(KZGTest, BatchPairingCheck)
+{
+    const size_t n = 16;
+    const size_t num_claims = 4;
+
+    using KZG = KZG<TypeParam>;
+    using Fr = typename TypeParam::ScalarField;
+    using GroupElement = typename TypeParam::Element;
+
+    std::vector<std::array<GroupElement, 2>> pairing_points;
+    for (size_t i = 0; i < num_claims; ++i) {
+        auto witness = this->random_polynomial(n);
+        auto challenge = Fr::random_element();
+        auto opening_pair = OpeningPair<TypeParam>{ challenge, witness.evaluate(challenge) };
+        auto opening_claim = OpeningClaim<TypeParam>{ opening_pair, this->commit(witness) };
+
+        auto prover_transcript = ProverTranscript<Fr>::init_empty();
+        KZG::compute_opening_proof(this->ck(), opening_pair, witness, prover_transcript);
+        auto verifier_transcript = VerifierTranscript<Fr>::init_empty(prover_transcript);
+        pairing_points.push_back(KZG::compute_pairing_points(opening_claim, verifier_transcript));
+    }
+    EXPECT_TRUE(this->vk()->batch_pairing_check(pairing_points));
+
+    // a claim with a wrong evaluation fails the whole batch
+    pairing_points[2][0] -= GroupElement::one();
+    EXPECT_FALSE(this->vk()->batch_pairing_check(pairing_points));
+}
+
 /**
  * @brief Test full PCS protocol: Gemini, Shplonk, KZG and pairing check
  * @details Demonstrates the full PCS protocol as it is used in the construction and verification
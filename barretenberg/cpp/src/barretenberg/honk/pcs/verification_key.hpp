@@ -16,9 +16,12 @@
 #include "barretenberg/srs/factories/crs_factory.hpp"
 #include "barretenberg/srs/factories/file_crs_factory.hpp"
 
+#include <array>
 #include <cstddef>
 #include <memory>
+#include <span>
 #include <string_view>
+#include <vector>
 
 namespace proof_system::honk::pcs {
 
@@ -65,6 +68,25 @@ template <> class VerifierCommitmentKey<curve::BN254> {
         return (result == Curve::TargetField::one());
     }
 
+    /**
+     * @brief verifies the pairing equations of several independent claims at once, with a single 2-point pairing
+     * (see pairing_check_batch_precomputed)
+     *
+     * @param pairing_points {P₀, P₁} of each claim, e.g. as computed by KZG::compute_pairing_points
+     * @return e(P₀,[1]₂)e(P₁,[x]₂) ≡ [1]ₜ for every claim
+     */
+    bool batch_pairing_check(std::span<const std::array<GroupElement, 2>> pairing_points)
+    {
+        std::vector<Commitment> affine_points(pairing_points.size() * 2);
+        for (size_t i = 0; i < pairing_points.size(); ++i) {
+            affine_points[2 * i] = pairing_points[i][0];
+            affine_points[2 * i + 1] = pairing_points[i][1];
+        }
+
+        return barretenberg::pairing::pairing_check_batch_precomputed(
+            affine_points.data(), srs->get_precomputed_g2_lines(), 2, pairing_points.size());
+    }
+
     std::shared_ptr<barretenberg::srs::factories::VerifierCrs<Curve>> srs;
 };
 
@@ -109,10 +109,9 @@ template <class Curve> class ZeroMorphTest : public CommitmentTest<Curve> {
             auto quotients = ZeroMorphProver::compute_multilinear_quotients(f_polynomial, u_challenge);
 
             // Compute and send commitments C_{q_k} = [q_k], k = 0,...,d-1
-            std::vector<Commitment> q_k_commitments;
-            q_k_commitments.reserve(log_N);
+            std::vector<std::span<const Fr>> quotient_spans(quotients.begin(), quotients.end());
+            std::vector<Commitment> q_k_commitments = this->ck()->batch_commit(quotient_spans);
             for (size_t idx = 0; idx < log_N; ++idx) {
-                q_k_commitments[idx] = this->commit(quotients[idx]);
                 std::string label = "ZM:C_q_" + std::to_string(idx);
                 prover_transcript.send_to_verifier(label, q_k_commitments[idx]);
             }
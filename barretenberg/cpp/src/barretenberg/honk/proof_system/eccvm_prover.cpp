@@ -334,6 +334,9 @@ template <ECCVMFlavor Flavor> plonk::proof& ECCVMProver_<Flavor>::export_proof()
 
 template <ECCVMFlavor Flavor> plonk::proof& ECCVMProver_<Flavor>::construct_proof()
 {
+    // The temporaries of the proof are allocated from the arena of the key, and reclaimed as they are released.
+    barretenberg::ProofArena::Scope arena_scope(key->arena.get());
+
     // Add circuit size public input size and public inputs to transcript.
     execute_preamble_round();
 
@@ -2,6 +2,7 @@
 #include "barretenberg/common/constexpr_utils.hpp"
 #include "barretenberg/honk/sumcheck/sumcheck.hpp"
 #include "barretenberg/plonk/proof_system/proving_key/proving_key.hpp"
+#include "barretenberg/polynomials/grand_product.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include <typeinfo>
 
@@ -31,19 +32,10 @@ namespace proof_system::honk::grand_product_library {
  *
  * For Flavor::Ultra both the UltraPermutation and Lookup grand products are computed by this method.
  *
- * The grand product is constructed over the course of three steps.
- *
- * For expositional simplicity, write Z_perm[i] as
- *
- *                A(j)
- * Z_perm[i] = ∏ --------------------------
- *                B(h)
- *
- * Step 1) Compute 2 length-n polynomials A, B
- * Step 2) Compute 2 length-n polynomials numerator = ∏ A(j), nenominator = ∏ B(j)
- * Step 3) Compute Z_perm[i + 1] = numerator[i] / denominator[i] (recall: Z_perm[0] = 1)
- *
- * Note: Step (3) utilizes Montgomery batch inversion to replace n-many inversions with
+ * The grand product is computed by barretenberg::compute_grand_product, which streams over the rows, computing the
+ * numerator and denominator terms of a block of rows at a time and folding their quotients into the running product,
+ * with one batch inversion per block. Neither the numerators nor the denominators are stored in full, and the work is
+ * spread over all threads.
  */
 template <typename Flavor, typename GrandProdRelation>
 void compute_grand_product(const size_t circuit_size,
@@ -51,90 +43,32 @@ void compute_grand_product(const size_t circuit_size,
                            proof_system::RelationParameters<typename Flavor::FF>& relation_parameters)
 {
     using FF = typename Flavor::FF;
-    using Polynomial = typename Flavor::Polynomial;
     using Accumulator = std::tuple_element_t<0, typename GrandProdRelation::ArrayOfValuesOverSubrelations>;
 
-    // Allocate numerator/denominator polynomials that will serve as scratch space
-    // TODO(zac) we can re-use the permutation polynomial as the numerator polynomial. Reduces readability
-    Polynomial numerator = Polynomial{ circuit_size };
-    Polynomial denominator = Polynomial{ circuit_size };
-
-    // Step (1)
-    // Populate `numerator` and `denominator` with the algebra described by Relation
-    const size_t num_threads = circuit_size >= get_num_cpus_pow2() ? get_num_cpus_pow2() : 1;
-    const size_t block_size = circuit_size / num_threads;
-    parallel_for(num_threads, [&](size_t thread_idx) {
-        const size_t start = thread_idx * block_size;
-        const size_t end = (thread_idx + 1) * block_size;
-        for (size_t i = start; i < end; ++i) {
-            typename Flavor::AllValues evaluations;
-            for (size_t k = 0; k < Flavor::NUM_ALL_ENTITIES; ++k) {
-                evaluations[k] = full_polynomials[k].size() > i ? full_polynomials[k][i] : 0;
-            }
-            numerator[i] = GrandProdRelation::template compute_grand_product_numerator<Accumulator>(
-                evaluations, relation_parameters);
-            denominator[i] = GrandProdRelation::template compute_grand_product_denominator<Accumulator>(
-                evaluations, relation_parameters);
-        }
-    });
-
-    // Step (2)
-    // Compute the accumulating product of the numerator and denominator terms.
-    // This step is split into three parts for efficient multithreading:
-    // (i) compute ∏ A(j), ∏ B(j) subproducts for each thread
-    // (ii) compute scaling factor required to convert each subproduct into a single running product
-    // (ii) combine subproducts into a single running product
-    //
-    // For example, consider 4 threads and a size-8 numerator { a0, a1, a2, a3, a4, a5, a6, a7 }
-    // (i)   Each thread computes 1 element of N = {{ a0, a0a1 }, { a2, a2a3 }, { a4, a4a5 }, { a6, a6a7 }}
-    // (ii)  Take partial products P = { 1, a0a1, a2a3, a4a5 }
-    // (iii) Each thread j computes N[i][j]*P[j]=
-    //      {{a0,a0a1},{a0a1a2,a0a1a2a3},{a0a1a2a3a4,a0a1a2a3a4a5},{a0a1a2a3a4a5a6,a0a1a2a3a4a5a6a7}}
-    std::vector<FF> partial_numerators(num_threads);
-    std::vector<FF> partial_denominators(num_threads);
-
-    parallel_for(num_threads, [&](size_t thread_idx) {
-        const size_t start = thread_idx * block_size;
-        const size_t end = (thread_idx + 1) * block_size;
-        for (size_t i = start; i < end - 1; ++i) {
-            numerator[i + 1] *= numerator[i];
-            denominator[i + 1] *= denominator[i];
-        }
-        partial_numerators[thread_idx] = numerator[end - 1];
-        partial_denominators[thread_idx] = denominator[end - 1];
-    });
-
-    parallel_for(num_threads, [&](size_t thread_idx) {
-        const size_t start = thread_idx * block_size;
-        const size_t end = (thread_idx + 1) * block_size;
-        if (thread_idx > 0) {
-            FF numerator_scaling = 1;
-            FF denominator_scaling = 1;
-
-            for (size_t j = 0; j < thread_idx; ++j) {
-                numerator_scaling *= partial_numerators[j];
-                denominator_scaling *= partial_denominators[j];
-            }
-            for (size_t i = start; i < end; ++i) {
-                numerator[i] *= numerator_scaling;
-                denominator[i] *= denominator_scaling;
-            }
-        }
+    auto& grand_product_polynomial = GrandProdRelation::get_grand_product_polynomial(full_polynomials);
 
-        // Final step: invert denominator
-        FF::batch_invert(std::span{ &denominator[start], block_size });
-    });
+    // The terms are computed from a copy of the polynomial spans without the grand product polynomial, which is written
+    // by other threads as the terms are computed, and which the terms do not depend on
+    auto term_polynomials = full_polynomials;
+    GrandProdRelation::get_grand_product_polynomial(term_polynomials) = {};
+    GrandProdRelation::get_shifted_grand_product_polynomial(term_polynomials) = {};
 
-    // Step (3) Compute z_perm[i] = numerator[i] / denominator[i]
-    auto& grand_product_polynomial = GrandProdRelation::get_grand_product_polynomial(full_polynomials);
+    // Compute grand_product_polynomial[i + 1] = ∏_{j ≤ i} relation::numerator(j) / relation::denominator(j)
     grand_product_polynomial[0] = 0;
-    parallel_for(num_threads, [&](size_t thread_idx) {
-        const size_t start = thread_idx * block_size;
-        const size_t end = (thread_idx == num_threads - 1) ? circuit_size - 1 : (thread_idx + 1) * block_size;
-        for (size_t i = start; i < end; ++i) {
-            grand_product_polynomial[i + 1] = numerator[i] * denominator[i];
-        }
-    });
+    barretenberg::compute_grand_product(
+        grand_product_polynomial.subspan(1, circuit_size - 1),
+        [&](size_t start, std::span<FF> numerators, std::span<FF> denominators) {
+            typename Flavor::AllValues evaluations;
+            for (size_t i = start; i < start + numerators.size(); ++i) {
+                for (size_t k = 0; k < Flavor::NUM_ALL_ENTITIES; ++k) {
+                    evaluations[k] = term_polynomials[k].size() > i ? term_polynomials[k][i] : 0;
+                }
+                numerators[i - start] = GrandProdRelation::template compute_grand_product_numerator<Accumulator>(
+                    evaluations, relation_parameters);
+                denominators[i - start] = GrandProdRelation::template compute_grand_product_denominator<Accumulator>(
+                    evaluations, relation_parameters);
+            }
+        });
 }
 
 template <typename Flavor>
@@ -56,7 +56,7 @@ void compute_logderivative_inverse(Polynomials& polynomials,
     };
 
     // todo might be inverting zero in field bleh bleh
-    FF::batch_invert(inverse_polynomial);
+    FF::parallel_batch_invert(inverse_polynomial);
 }
 
 } // namespace proof_system::honk::lookup_library
\ No newline at end of file
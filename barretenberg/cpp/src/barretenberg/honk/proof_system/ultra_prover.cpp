@@ -214,6 +214,9 @@ template <UltraFlavor Flavor> plonk::proof& UltraProver_<Flavor>::export_proof()
 
 template <UltraFlavor Flavor> plonk::proof& UltraProver_<Flavor>::construct_proof()
 {
+    // The temporaries of the proof are allocated from the arena of the key, and reclaimed as they are released.
+    barretenberg::ProofArena::Scope arena_scope(instance->proving_key->arena.get());
+
     // Add circuit size public input size and public inputs to transcript.
     execute_preamble_round();
 
@@ -102,16 +102,29 @@ template <typename Curve> class work_queue {
 
     void process_queue()
     {
-        for (const auto& item : work_item_queue) {
+        // The commitments are computed together, with batched multi-scalar-multiplications (see batch_commit)
+        std::vector<size_t> item_indices;
+        std::vector<std::span<const FF>> polynomials;
+        for (size_t i = 0; i < work_item_queue.size(); ++i) {
+            if (work_item_queue[i].work_type == WorkType::SCALAR_MULTIPLICATION) {
+                item_indices.push_back(i);
+                polynomials.emplace_back(work_item_queue[i].mul_scalars);
+            }
+        }
+        // Run pippenger multi-scalar multiplication.
+        auto batch_commitments = commitment_key->batch_commit(polynomials);
+        std::vector<Commitment> commitments(work_item_queue.size());
+        for (size_t j = 0; j < item_indices.size(); ++j) {
+            commitments[item_indices[j]] = batch_commitments[j];
+        }
+
+        // The commitments are sent in queue order, which the verifier's transcript relies on
+        for (size_t i = 0; i < work_item_queue.size(); ++i) {
+            const auto& item = work_item_queue[i];
             switch (item.work_type) {
 
             case WorkType::SCALAR_MULTIPLICATION: {
-
-                // Run pippenger multi-scalar multiplication.
-                auto commitment = commitment_key->commit(item.mul_scalars);
-
-                transcript.send_to_verifier(item.label, commitment);
-
+                transcript.send_to_verifier(item.label, commitments[i]);
                 break;
             }
             default: {
@@ -52,6 +52,11 @@ template <typename Flavor> class SumcheckProver {
     *
     * NOTE: With ~40 columns, prob only want to allocate 256 EdgeGroup's at once to keep stack under 1MB?
     * TODO(#224)(Cody): might want to just do C-style multidimensional array? for guaranteed adjacency?
+    *
+    * The storage is allocated by the first partial evaluation that writes to it. In prove, that is the partial
+    * evaluation of the second round, as the first is not written out but computed as the polynomials are read in the
+    * second round (see FoldedPolynomial). Its polynomials are hence of size n/4 rather than n/2, which halves the memory
+    * used by sumcheck on top of the full polynomials. It is released once the evaluations have been extracted.
     */
     PartiallyEvaluatedMultivariates partially_evaluated_polynomials;
 
@@ -60,8 +65,7 @@ template <typename Flavor> class SumcheckProver {
         : transcript(transcript)
         , multivariate_n(multivariate_n)
         , multivariate_d(numeric::get_msb(multivariate_n))
-        , round(multivariate_n)
-        , partially_evaluated_polynomials(multivariate_n){};
+        , round(multivariate_n){};
 
     /**
      * @brief Compute univariate restriction place in transcript, generate challenge, partially evaluate,... repeat
@@ -81,19 +85,37 @@ template <typename Flavor> class SumcheckProver {
         multivariate_challenge.reserve(multivariate_d);
 
         // First round
-        // This populates partially_evaluated_polynomials.
         auto round_univariate = round.compute_univariate(full_polynomials, relation_parameters, pow_univariate, alpha);
         transcript.send_to_verifier("Sumcheck:univariate_0", round_univariate);
         FF round_challenge = transcript.get_challenge("Sumcheck:u_0");
         multivariate_challenge.emplace_back(round_challenge);
-        partially_evaluate(full_polynomials, multivariate_n, round_challenge);
         pow_univariate.partially_evaluate(round_challenge);
-        round.round_size =
-            round.round_size >> 1; // TODO(#224)(Cody): Maybe partially_evaluate should do this and release memory?
+        round.round_size = round.round_size >> 1;
+
+        if (multivariate_d == 1) {
+            partially_evaluate(full_polynomials, multivariate_n, round_challenge);
+        } else {
+            // Second round
+            // The full polynomials are partially evaluated at u_0 as they are read, and this populates
+            // partially_evaluated_polynomials with their partial evaluation at (u_0, u_1).
+            std::vector<FoldedPolynomial> folded_polynomials;
+            folded_polynomials.reserve(full_polynomials.size());
+            for (auto& polynomial : full_polynomials) {
+                folded_polynomials.push_back({ polynomial.data(), round_challenge });
+            }
+            round_univariate =
+                round.compute_univariate(folded_polynomials, relation_parameters, pow_univariate, alpha);
+            transcript.send_to_verifier("Sumcheck:univariate_1", round_univariate);
+            round_challenge = transcript.get_challenge("Sumcheck:u_1");
+            multivariate_challenge.emplace_back(round_challenge);
+            partially_evaluate(folded_polynomials, round.round_size, round_challenge);
+            pow_univariate.partially_evaluate(round_challenge);
+            round.round_size = round.round_size >> 1;
+        }
 
         // All but final round
         // We operate on partially_evaluated_polynomials in place.
-        for (size_t round_idx = 1; round_idx < multivariate_d; round_idx++) {
+        for (size_t round_idx = 2; round_idx < multivariate_d; round_idx++) {
             // Write the round univariate to the transcript
             round_univariate =
                 round.compute_univariate(partially_evaluated_polynomials, relation_parameters, pow_univariate, alpha);
@@ -113,6 +135,7 @@ template <typename Flavor> class SumcheckProver {
             multivariate_evaluations[evaluation_idx] = polynomial[0];
             ++evaluation_idx;
         }
+        partially_evaluated_polynomials = PartiallyEvaluatedMultivariates();
         transcript.send_to_verifier("Sumcheck:evaluations", multivariate_evaluations._data);
 
         return { multivariate_challenge, multivariate_evaluations };
@@ -137,7 +160,11 @@ template <typename Flavor> class SumcheckProver {
      */
     void partially_evaluate(auto& polynomials, size_t round_size, FF round_challenge)
     {
-        // after the first round, operate in place on partially_evaluated_polynomials
+        // The first partial evaluation allocates the storage, later ones operate in place on
+        // partially_evaluated_polynomials
+        if (partially_evaluated_polynomials[0].size() < (round_size >> 1)) {
+            partially_evaluated_polynomials = PartiallyEvaluatedMultivariates(round_size);
+        }
         for (size_t j = 0; j < polynomials.size(); ++j) {
             for (size_t i = 0; i < round_size; i += 2) {
                 partially_evaluated_polynomials[j][i >> 1] =
@@ -145,6 +172,22 @@ template <typename Flavor> class SumcheckProver {
             }
         }
     };
+
+  private:
+    /**
+     * @brief A full polynomial partially evaluated at the challenge of the first round, computed as it is read rather
+     * than stored: (*this)[i] = P(u_0, i) = P[2i] + u_0 (P[2i + 1] - P[2i]).
+     */
+    struct FoldedPolynomial {
+        const FF* coefficients;
+        FF challenge;
+
+        FF operator[](size_t i) const
+        {
+            const FF& left = coefficients[2 * i];
+            return left + challenge * (coefficients[2 * i + 1] - left);
+        }
+    };
 };
 
 template <typename Flavor> class SumcheckVerifier {
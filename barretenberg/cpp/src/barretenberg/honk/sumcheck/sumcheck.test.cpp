@@ -113,8 +113,8 @@ TEST_F(SumcheckTests, PolynomialNormalization)
     FF u_1 = output.challenge[1];
     FF u_2 = output.challenge[2];
 
-    /* sumcheck.prove() terminates with sumcheck.multivariates.folded_polynoimals as an array such that
-     * sumcheck.multivariates.folded_polynoimals[i][0] is the evaluatioin of the i'th multivariate at the vector of
+    /* sumcheck.prove() terminates with output.claimed_evaluations as an array such that
+     * output.claimed_evaluations[i] is the evaluatioin of the i'th multivariate at the vector of
      challenges u_i. What does this mean?
 
      Here we show that if the multivariate is F(X0, X1, X2) defined as above, then what we get is F(u0, u1, u2) and
@@ -141,7 +141,7 @@ TEST_F(SumcheckTests, PolynomialNormalization)
                               l_2 * full_polynomials[i][2] + l_3 * full_polynomials[i][3] +
                               l_4 * full_polynomials[i][4] + l_5 * full_polynomials[i][5] +
                               l_6 * full_polynomials[i][6] + l_7 * full_polynomials[i][7];
-        EXPECT_EQ(hand_computed_value, sumcheck.partially_evaluated_polynomials[i][0]);
+        EXPECT_EQ(hand_computed_value, output.claimed_evaluations[i]);
     }
 
     // We can also check the correctness of the multilinear evaluations produced by Sumcheck by directly evaluating the
@@ -112,8 +112,7 @@ template <typename Flavor> class SumcheckProverRound {
     {
         size_t univariate_idx = 0; // TODO(https://github.com/AztecProtocol/barretenberg/issues/391) zip
         for (auto& poly : multivariates) {
-            auto edge = barretenberg::Univariate<FF, 2>({ poly[edge_idx], poly[edge_idx + 1] });
-            extended_edges[univariate_idx] = barycentric_2_to_max.extend(edge);
+            barycentric_2_to_max.extend_edge(poly[edge_idx], poly[edge_idx + 1], extended_edges[univariate_idx]);
             ++univariate_idx;
         }
     }
@@ -202,6 +201,11 @@ template <typename Flavor> class SumcheckProverRound {
      * Result: for each relation, a univariate of some degree is computed by accumulating the contributions of each
      * group of edges. These are stored in `univariate_accumulators`. Adding these univariates together, with
      * appropriate scaling factors, produces S_l.
+     *
+     * A relation gated by a selector (see isSkippable) is skipped on the edges where its selector is zero, i.e. off the
+     * gates of its type, as it contributes nothing there. Circuits are mostly made of one or two types of gates, so
+     * this skips most evaluations of the other relations. The selectors stay zero on those edges in later rounds, as
+     * folding the polynomials preserves zero edges.
      */
     template <size_t relation_idx = 0>
     void accumulate_relation_univariates(TupleOfTuplesOfUnivariates& univariate_accumulators,
@@ -210,8 +214,14 @@ template <typename Flavor> class SumcheckProverRound {
                                          const FF& scaling_factor)
     {
         using Relation = std::tuple_element_t<relation_idx, Relations>;
-        Relation::accumulate(
-            std::get<relation_idx>(univariate_accumulators), extended_edges, relation_parameters, scaling_factor);
+        bool skip = false;
+        if constexpr (isSkippable<Relation, decltype(extended_edges)>) {
+            skip = Relation::skip(extended_edges);
+        }
+        if (!skip) {
+            Relation::accumulate(
+                std::get<relation_idx>(univariate_accumulators), extended_edges, relation_parameters, scaling_factor);
+        }
 
         // Repeat for the next relation.
         if constexpr (relation_idx + 1 < NUM_RELATIONS) {
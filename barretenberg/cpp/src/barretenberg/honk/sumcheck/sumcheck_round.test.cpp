@@ -140,4 +140,43 @@ TEST(SumcheckRound, AddTuplesOfTuplesOfUnivariates)
     EXPECT_EQ(std::get<1>(std::get<1>(tuple_of_tuples_1)), expected_sum_3);
 }
 
+/**
+ * @brief Check that a relation gated by a selector is skipped exactly where it contributes nothing
+ *
+ */
+TEST(SumcheckRound, SkipRelationsWithZeroSelector)
+{
+    using Edges = Flavor::ExtendedEdges<Flavor::MAX_RELATION_LENGTH>;
+    auto parameters = proof_system::RelationParameters<FF>::get_random();
+
+    auto check_relation = [&]<typename Relation>(auto get_selector) {
+        Edges edges;
+        for (auto& edge : edges) {
+            edge = Univariate<FF, Flavor::MAX_RELATION_LENGTH>::get_random();
+        }
+        EXPECT_FALSE(Relation::skip(edges));
+
+        get_selector(edges) = Univariate<FF, Flavor::MAX_RELATION_LENGTH>(0);
+        EXPECT_TRUE(Relation::skip(edges));
+        typename Relation::TupleOfUnivariatesOverSubrelations accumulators;
+        auto wrapped_accumulators = std::tie(accumulators);
+        SumcheckProverRound<Flavor>::zero_univariates(wrapped_accumulators);
+        Relation::accumulate(accumulators, edges, parameters, FF::random_element());
+        auto all_zero = [](auto&... accumulator) { return (accumulator.is_zero() && ...); };
+        EXPECT_TRUE(std::apply(all_zero, accumulators));
+    };
+    check_relation.template operator()<proof_system::UltraArithmeticRelation<FF>>(
+        [](Edges& edges) -> auto& { return edges.q_arith; });
+    check_relation.template operator()<proof_system::GenPermSortRelation<FF>>(
+        [](Edges& edges) -> auto& { return edges.q_sort; });
+    check_relation.template operator()<proof_system::EllipticRelation<FF>>(
+        [](Edges& edges) -> auto& { return edges.q_elliptic; });
+    check_relation.template operator()<proof_system::AuxiliaryRelation<FF>>(
+        [](Edges& edges) -> auto& { return edges.q_aux; });
+
+    // The grand product relations are active on every row.
+    static_assert(!proof_system::isSkippable<proof_system::UltraPermutationRelation<FF>, Edges>);
+    static_assert(!proof_system::isSkippable<proof_system::LookupRelation<FF>, Edges>);
+}
+
 } // namespace test_sumcheck_round
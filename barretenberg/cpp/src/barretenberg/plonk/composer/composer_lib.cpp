@@ -18,6 +18,11 @@ namespace proof_system::plonk {
 void compute_monomial_and_coset_selector_forms(plonk::proving_key* circuit_proving_key,
                                                std::vector<SelectorProperties> selector_properties)
 {
+    std::vector<barretenberg::polynomial> selector_polys;
+    std::vector<barretenberg::polynomial> selector_poly_ffts;
+    std::vector<barretenberg::fr*> selector_poly_fft_coeffs;
+    selector_polys.reserve(selector_properties.size());
+    selector_poly_ffts.reserve(selector_properties.size());
     for (size_t i = 0; i < selector_properties.size(); i++) {
         // Compute monomial form of selector polynomial
         auto selector_poly_lagrange =
@@ -26,14 +31,21 @@ void compute_monomial_and_coset_selector_forms(plonk::proving_key* circuit_provi
         barretenberg::polynomial_arithmetic::ifft(
             &selector_poly_lagrange[0], &selector_poly[0], circuit_proving_key->small_domain);
 
-        // Compute coset FFT of selector polynomial
-        barretenberg::polynomial selector_poly_fft(selector_poly, circuit_proving_key->circuit_size * 4 + 4);
-        selector_poly_fft.coset_fft(circuit_proving_key->large_domain);
+        selector_poly_ffts.emplace_back(selector_poly, circuit_proving_key->circuit_size * 4 + 4);
+        selector_poly_fft_coeffs.push_back(&selector_poly_ffts.back()[0]);
+        selector_polys.push_back(std::move(selector_poly));
+    }
+
+    // Compute coset FFTs of all selector polynomials together
+    barretenberg::polynomial_arithmetic::coset_fft_many<barretenberg::fr>(selector_poly_fft_coeffs,
+                                                                          circuit_proving_key->large_domain);
 
+    for (size_t i = 0; i < selector_properties.size(); i++) {
         // Note: For Standard, the lagrange polynomials could be removed from the store at this point but this
         // is not the case for Ultra.
-        circuit_proving_key->polynomial_store.put(selector_properties[i].name, std::move(selector_poly));
-        circuit_proving_key->polynomial_store.put(selector_properties[i].name + "_fft", std::move(selector_poly_fft));
+        circuit_proving_key->polynomial_store.put(selector_properties[i].name, std::move(selector_polys[i]));
+        circuit_proving_key->polynomial_store.put(selector_properties[i].name + "_fft",
+                                                  std::move(selector_poly_ffts[i]));
     }
 }
 
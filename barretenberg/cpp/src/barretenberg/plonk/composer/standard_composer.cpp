@@ -29,6 +29,7 @@ void StandardComposer::compute_witness(const CircuitBuilder& circuit_constructor
     if (computed_witness) {
         return;
     }
+    barretenberg::ProofArena::Scope arena_scope(circuit_proving_key->arena.get());
     const size_t num_gates = circuit_constructor.num_gates;
     const size_t num_public_inputs = circuit_constructor.public_inputs.size();
 
@@ -69,6 +70,7 @@ std::shared_ptr<plonk::proving_key> StandardComposer::compute_proving_key(const
     // TODO(#392)(Kesha): replace composer types.
     circuit_proving_key = initialize_proving_key(
         circuit_constructor, crs_factory_.get(), minimum_circuit_size, num_randomized_gates, CircuitType::STANDARD);
+    barretenberg::ProofArena::Scope arena_scope(circuit_proving_key->arena.get());
     // Compute lagrange selectors
     construct_selector_polynomials<Flavor>(circuit_constructor, circuit_proving_key.get());
     // Make all selectors nonzero
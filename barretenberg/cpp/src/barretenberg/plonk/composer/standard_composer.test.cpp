@@ -33,6 +33,29 @@ TEST_F(StandardPlonkComposer, BaseCase)
     EXPECT_EQ(result, true);
 }
 
+// The memory the first proof frees, including the holes left by the polynomials the store replaces, serves the second.
+TEST_F(StandardPlonkComposer, ProofsFromOneKeyStayInItsArena)
+{
+    auto builder = StandardCircuitBuilder();
+    auto composer = StandardComposer();
+    fr a = fr::one();
+    builder.add_public_variable(a);
+    for (size_t i = 0; i < 1000; ++i) {
+        uint32_t a_idx = builder.add_variable(a);
+        uint32_t b_idx = builder.add_variable(a);
+        uint32_t c_idx = builder.add_variable(a + a);
+        builder.create_add_gate({ a_idx, b_idx, c_idx, fr::one(), fr::one(), fr::neg_one(), fr::zero() });
+    }
+
+    for (size_t proof_index = 0; proof_index < 2; ++proof_index) {
+        auto prover = composer.create_prover(builder);
+        auto verifier = composer.create_verifier(builder);
+        plonk::proof proof = prover.construct_proof();
+        EXPECT_TRUE(verifier.verify_proof(proof));
+        EXPECT_EQ(prover.key->arena->get_num_heap_allocations(), 0U);
+    }
+}
+
 TEST_F(StandardPlonkComposer, ComposerFromSerializedKeys)
 {
     auto builder = StandardCircuitBuilder();
@@ -27,6 +27,8 @@ void UltraComposer::compute_witness(CircuitBuilder& circuit_constructor)
         return;
     }
 
+    barretenberg::ProofArena::Scope arena_scope(circuit_proving_key->arena.get());
+
     size_t tables_size = 0;
     size_t lookups_size = 0;
     for (const auto& table : circuit_constructor.lookup_tables) {
@@ -380,6 +382,7 @@ std::shared_ptr<proving_key> UltraComposer::compute_proving_key(CircuitBuilder&
     // TODO(#392)(Kesha): replace composer types.
     circuit_proving_key = initialize_proving_key(
         circuit_constructor, crs_factory.get(), minimum_circuit_size, num_randomized_gates, CircuitType::ULTRA);
+    barretenberg::ProofArena::Scope arena_scope(circuit_proving_key->arena.get());
 
     construct_selector_polynomials<Flavor>(circuit_constructor, circuit_proving_key.get());
 
@@ -169,6 +169,55 @@ TYPED_TEST(ultra_plonk_composer, test_no_lookup_proof)
     TestFixture::prove_and_verify(builder, composer, /*expected_result=*/true);
 }
 
+TYPED_TEST(ultra_plonk_composer, verify_proofs)
+{
+    // Circuits of the same shape share a verification key, whatever their witnesses.
+    const auto build_circuit = [](const fr& left, const fr& right, const fr& result) {
+        auto builder = UltraCircuitBuilder();
+        uint32_t left_idx = builder.add_public_variable(left);
+        uint32_t right_idx = builder.add_variable(right);
+        uint32_t result_idx = builder.add_variable(result);
+        builder.create_poly_gate({ left_idx, right_idx, result_idx, fr(1), fr(1), fr(0), fr(-1), fr(0) });
+        return builder;
+    };
+    const auto prove = [](UltraCircuitBuilder& builder) {
+        auto composer = UltraComposer();
+        if constexpr (TypeParam::use_keccak) {
+            return composer.create_ultra_with_keccak_prover(builder).construct_proof();
+        } else {
+            return composer.create_prover(builder).construct_proof();
+        }
+    };
+
+    constexpr size_t num_proofs = 4;
+    std::vector<UltraCircuitBuilder> builders;
+    std::vector<plonk::proof> proofs;
+    for (size_t i = 0; i < num_proofs; ++i) {
+        const fr left = fr::random_element();
+        const fr right = fr::random_element();
+        builders.emplace_back(build_circuit(left, right, left * right + left));
+        proofs.emplace_back(prove(builders.back()));
+    }
+    // the proof of a false statement
+    auto bad_builder = build_circuit(fr(2), fr(3), fr(7));
+    auto bad_proof = prove(bad_builder);
+
+    auto composer = UltraComposer();
+    auto verifier = [&]() {
+        if constexpr (TypeParam::use_keccak) {
+            return composer.create_ultra_with_keccak_verifier(builders[0]);
+        } else {
+            return composer.create_verifier(builders[0]);
+        }
+    }();
+    EXPECT_TRUE(verifier.verify_proofs(proofs));
+    EXPECT_TRUE(verifier.verify_proofs(std::span(proofs).subspan(1, 1)));
+
+    proofs[2] = bad_proof;
+    EXPECT_FALSE(verifier.verify_proof(bad_proof));
+    EXPECT_FALSE(verifier.verify_proofs(proofs));
+}
+
 TYPED_TEST(ultra_plonk_composer, test_elliptic_gate)
 {
     typedef grumpkin::g1::affine_element affine_element;
@@ -494,6 +494,9 @@ template <typename settings> plonk::proof& ProverBase<settings>::export_proof()
 
 template <typename settings> plonk::proof& ProverBase<settings>::construct_proof()
 {
+    // The temporaries of the proof are allocated from the arena of the key, and reclaimed as they are released.
+    barretenberg::ProofArena::Scope arena_scope(key->arena.get());
+
     // Execute init round. Randomize witness polynomials.
     // info("preamble");
     execute_preamble_round();
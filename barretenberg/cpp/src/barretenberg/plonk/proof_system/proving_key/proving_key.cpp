@@ -1,4 +1,5 @@
 #include "proving_key.hpp"
+#include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
@@ -53,7 +54,7 @@ proving_key::proving_key(proving_key_data&& data,
     , recursive_proof_public_input_indices(std::move(data.recursive_proof_public_input_indices))
     , memory_read_records(data.memory_read_records)
     , memory_write_records(data.memory_write_records)
-    , polynomial_store(data.polynomial_store)
+    , polynomial_store(std::move(data.polynomial_store))
     , small_domain(circuit_size, circuit_size)
     , large_domain(4 * circuit_size, circuit_size > min_thread_block ? circuit_size : 4 * circuit_size)
     , reference_string(crs)
@@ -66,7 +67,7 @@ proving_key::proving_key(proving_key_data&& data,
  * Initialize proving key.
  *
  * 1. Compute lookup tables for small, mid and large domains
- * 2. Set capacity for polynomial store cache
+ * 2. Create the proof arena, which grows as the polynomials are allocated
  * 3. Initialize quotient_polynomial_parts(n+1) to zeroes.
  **/
 void proving_key::init()
@@ -76,6 +77,15 @@ void proving_key::init()
         large_domain.compute_lookup_table();
     }
 
+    // The monomial and coset forms (of size 4n) of each polynomial of the manifest, besides the quotient polynomial parts,
+    // are about half of what a proof holds at its peak; the Lagrange forms and the prover temporaries make up the rest.
+    // The arena only reserves what is used, so its capacity leaves as much headroom again.
+    const size_t polynomial_footprint =
+        pad((circuit_size + 1) * sizeof(barretenberg::fr), barretenberg::ProofArena::ALIGNMENT);
+    const size_t num_polynomials = 5 * polynomial_manifest.size() + NUM_QUOTIENT_PARTS;
+    arena = barretenberg::ProofArena::create(4 * num_polynomials * polynomial_footprint);
+    barretenberg::ProofArena::Scope arena_scope(arena.get());
+
     // t_i for i = 1,2,3 have n+1 coefficients after blinding. t_4 has only n coefficients.
     quotient_polynomial_parts[0] = barretenberg::polynomial(circuit_size + 1);
     quotient_polynomial_parts[1] = barretenberg::polynomial(circuit_size + 1);
@@ -2,6 +2,7 @@
 #include <map>
 #include <unordered_map>
 
+#include "barretenberg/common/proof_arena.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/scalar_multiplication/runtime_states.hpp"
 #include "barretenberg/plonk/proof_system/constants.hpp"
@@ -82,6 +83,9 @@ struct proving_key {
 
     PolynomialManifest polynomial_manifest;
 
+    // Serves the polynomials of the key and the temporaries of the proofs made from it
+    std::shared_ptr<barretenberg::ProofArena> arena;
+
     static constexpr size_t min_thread_block = 4UL;
 };
 
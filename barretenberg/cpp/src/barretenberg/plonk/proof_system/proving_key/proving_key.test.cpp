@@ -89,60 +89,34 @@ TEST(proving_key, proving_key_from_serialized_key_ultra)
     EXPECT_EQ(p_key.contains_recursive_proof, proving_key->contains_recursive_proof);
 }
 
-/**
-// Test that a proving key can be serialized/deserialized using mmap
+// Test that a proving key can be written to, and mapped from, a polynomial file, and then used to prove
 #ifndef __wasm__
-TEST(proving_key, proving_key_from_mmaped_key)
+TEST(proving_key, proving_key_from_mapped_key)
 {
-        builder coStandardCircuitBuilder = StandardComposer();auto composer =
-StandardComposer(); fr a = fr::one(); builder.add_public_variable(a);
-
-    // Write each precomputed polynomial in the proving key to
-    // its own file using write_mmap
-    std::string pk_dir = "../src/barretenberg/proof_system/proving_key/fixtures";
-    std::filesystem::create_directories(pk_dir);
-    std::string pk_path = pk_dir + "/proving_key";
-    std::ofstream os(pk_path);
-    // TODO: Investigate why this test fails in CI.
-    // WASI-SDK does not include support for <filesystem>, so we had to replace the call to
-    // `std::filesystem::create_directories(pk_dir);`
-    // with
-    // `mkdir(pk_dir.c_str(), 0700);`.
-    // It looks like the POSIX method would set the ERRNO after attempting to create the directory.
-    // The exception block is left here to help solve the problem later.
-    // try {
-    //     os.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-    // } catch (const std::ios_base::failure& e) {
-    //     std::cout << "Caught an ios_base::failure.\n"
-    //               << "Error code: " << e.code().value() << " (" << e.code().message() << ")\n"
-    //               << "Error category: " << e.code().category().name() << '\n';
-    // }
-    if (!os.good()) {
-        std::cerr << "OS failed in composer_from_mmap_keys! \n";
-    }
+    auto builder = UltraCircuitBuilder();
+    auto composer = UltraComposer();
+    fr a = fr::one();
+    builder.add_public_variable(a);
+    uint32_t a_idx = builder.add_variable(a);
+    uint32_t b_idx = builder.add_variable(a + a);
+    builder.create_add_gate({ a_idx, a_idx, b_idx, 1, 1, -1, 0 });
+
     plonk::proving_key& p_key = *composer.compute_proving_key(builder);
-    write_mmap(os, pk_dir, p_key);
-    os.close();
-
-    // Read each precomputed polynomial from the files written above
-    // into a proving_key_data polynomial store using read_mmap
-    std::ifstream pk_stream = std::ifstream(pk_path);
-    if (!pk_stream.good()) {
-        std::cerr << "IS failed in composer_from_mmap_keys! \n";
-    }
+    const std::string pk_path = std::filesystem::temp_directory_path() / "proving_key_from_mapped_key";
+    write_mapped(pk_path, p_key);
+
     plonk::proving_key_data pk_data;
-    read_mmap(pk_stream, pk_dir, pk_data);
-    pk_stream.close();
+    read_mapped(pk_path, pk_data);
+    std::filesystem::remove(pk_path);
 
     // Loop over all pre-computed polys for the given composer type and ensure equality
-    // between original proving key polynomial store and the polynomial store that was
-    // serialized/deserialized via mmap
+    // between original proving key polynomial store and the polynomial store that was mapped
     plonk::PrecomputedPolyList precomputed_poly_list(p_key.circuit_type);
     bool all_polys_are_equal{ true };
     for (size_t i = 0; i < precomputed_poly_list.size(); ++i) {
         std::string poly_id = precomputed_poly_list[i];
-        barretenberg::polynomial& input_poly = p_key.polynomial_store.get(poly_id);
-        barretenberg::polynomial& output_poly = pk_data.polynomial_store.get(poly_id);
+        auto input_poly = p_key.polynomial_store.get(poly_id);
+        auto output_poly = pk_data.polynomial_store.get(poly_id);
         all_polys_are_equal = all_polys_are_equal && (input_poly == output_poly);
     }
 
@@ -150,10 +124,19 @@ StandardComposer(); fr a = fr::one(); builder.add_public_variable(a);
     EXPECT_EQ(all_polys_are_equal, true);
 
     // Check equality of other proving_key_data data
-    EXPECT_EQ(p_key.circuit_type, pk_data.circuit_type);
+    EXPECT_EQ(p_key.circuit_type, static_cast<CircuitType>(pk_data.circuit_type));
     EXPECT_EQ(p_key.circuit_size, pk_data.circuit_size);
     EXPECT_EQ(p_key.num_public_inputs, pk_data.num_public_inputs);
     EXPECT_EQ(p_key.contains_recursive_proof, pk_data.contains_recursive_proof);
+
+    // Prove with the mapped key
+    auto crs = std::make_unique<barretenberg::srs::factories::FileCrsFactory<curve::BN254>>("../srs_db/ignition");
+    const size_t circuit_size = pk_data.circuit_size;
+    auto mapped_key = std::make_shared<plonk::proving_key>(std::move(pk_data), crs->get_prover_crs(circuit_size + 1));
+    auto mapped_composer = UltraComposer(mapped_key, nullptr);
+    auto prover = mapped_composer.create_prover(builder);
+    auto proof = prover.construct_proof();
+    auto verifier = composer.create_verifier(builder);
+    EXPECT_TRUE(verifier.verify_proof(proof));
 }
 #endif
-*/
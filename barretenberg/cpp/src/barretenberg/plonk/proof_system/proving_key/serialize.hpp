@@ -2,10 +2,12 @@
 #include "barretenberg/common/serialize.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/crypto/sha256/sha256.hpp"
+#include "barretenberg/polynomials/polynomial_file.hpp"
 #include "barretenberg/polynomials/serialize.hpp"
 #include "proving_key.hpp"
 #include <fcntl.h>
 #include <ios>
+#include <sstream>
 #include <sys/stat.h>
 
 namespace proof_system::plonk {
@@ -138,4 +140,54 @@ template <typename B> inline void write_to_file(B& os, std::string const& path,
     write(os, key.memory_write_records);
 }
 
+/**
+ * Write the pre-computed polynomials, and the rest of the key, to a single polynomial file (see PolynomialFile).
+ */
+inline void write_mapped(std::string const& path, proving_key& key)
+{
+    using serialize::write;
+    barretenberg::PolynomialFile file;
+    PrecomputedPolyList precomputed_poly_list(key.circuit_type);
+    for (size_t i = 0; i < precomputed_poly_list.size(); ++i) {
+        const std::string& poly_id = precomputed_poly_list[i];
+        file.add(poly_id, key.polynomial_store.get(poly_id));
+    }
+
+    std::ostringstream metadata;
+    write(metadata, static_cast<uint32_t>(key.circuit_type));
+    write(metadata, static_cast<uint32_t>(key.circuit_size));
+    write(metadata, static_cast<uint32_t>(key.num_public_inputs));
+    write(metadata, key.contains_recursive_proof);
+    write(metadata, key.recursive_proof_public_input_indices);
+    write(metadata, key.memory_read_records);
+    write(metadata, key.memory_write_records);
+    const std::string metadata_bytes = metadata.str();
+    file.set_metadata({ metadata_bytes.begin(), metadata_bytes.end() });
+    file.write(path);
+}
+
+/**
+ * Read a key written by write_mapped. The pre-computed polynomials are mapped from the file, without a copy.
+ */
+inline void read_mapped(std::string const& path, proving_key_data& key)
+{
+    using serialize::read;
+    const auto file = barretenberg::PolynomialFile::map(path);
+
+    const auto* it = file.get_metadata().data();
+    read(it, key.circuit_type);
+    read(it, key.circuit_size);
+    read(it, key.num_public_inputs);
+    read(it, key.contains_recursive_proof);
+    read(it, key.recursive_proof_public_input_indices);
+    read(it, key.memory_read_records);
+    read(it, key.memory_write_records);
+
+    PrecomputedPolyList precomputed_poly_list(static_cast<CircuitType>(key.circuit_type));
+    for (size_t i = 0; i < precomputed_poly_list.size(); ++i) {
+        const std::string& poly_id = precomputed_poly_list[i];
+        key.polynomial_store.put(poly_id, file.get<barretenberg::fr>(poly_id));
+    }
+}
+
 } // namespace proof_system::plonk
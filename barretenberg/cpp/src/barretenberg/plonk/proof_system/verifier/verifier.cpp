@@ -1,6 +1,7 @@
 #include "./verifier.hpp"
 #include "../public_inputs/public_inputs.hpp"
 #include "../utils/kate_verification.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/ecc/curves/bn254/fq12.hpp"
 #include "barretenberg/ecc/curves/bn254/pairing.hpp"
@@ -8,6 +9,8 @@
 #include "barretenberg/plonk/proof_system/constants.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 
+#include <exception>
+
 using namespace barretenberg;
 
 namespace proof_system::plonk {
@@ -36,7 +39,51 @@ VerifierBase<program_settings>& VerifierBase<program_settings>::operator=(Verifi
     return *this;
 }
 
-template <typename program_settings> bool VerifierBase<program_settings>::verify_proof(const plonk::proof& proof)
+namespace {
+/**
+ * @brief The points of the final pairing check of a proof, e(P₀,[1]₂)e(P₁,[x]₂) ≡ [1]ₜ, before any msm is computed
+ *
+ * @details P₀ = ∑ scalars[i]⋅elements[i] + P0_offset and P₁ = -(separator_challenge⋅PI_Z_OMEGA + PI_Z) + P1_offset.
+ * The offsets hold the pairing points of a recursive proof aggregated into the proof, if any. Leaving the msms
+ * unevaluated lets the msms of several proofs be merged into one.
+ */
+struct pairing_claim {
+    std::vector<std::string> labels;
+    std::vector<fr> scalars;
+    std::vector<g1::affine_element> elements;
+    g1::element P0_offset;
+    g1::affine_element PI_Z;
+    g1::affine_element PI_Z_OMEGA;
+    fr separator_challenge;
+    g1::element P1_offset;
+};
+
+g1::element pippenger_msm(std::vector<fr>& scalars, std::vector<g1::affine_element> elements)
+{
+    g1::element result;
+    result.self_set_infinity();
+    const size_t num_elements = elements.size();
+    if (num_elements == 0) {
+        return result;
+    }
+    elements.resize(num_elements * 2);
+    barretenberg::scalar_multiplication::generate_pippenger_point_table<curve::BN254>(
+        &elements[0], &elements[0], num_elements);
+    scalar_multiplication::pippenger_runtime_state<curve::BN254> state(num_elements);
+    return barretenberg::scalar_multiplication::pippenger<curve::BN254>(&scalars[0], &elements[0], num_elements, state);
+}
+
+/**
+ * @brief Run every step of the verification of `proof` against `key` except the final pairing check. Writes to the
+ * `z_pow_n` and `program_width` of the key, so concurrent calls need their own copy of it.
+ */
+template <typename program_settings>
+pairing_claim compute_pairing_claim(const plonk::proof& proof,
+                                    const transcript::Manifest& manifest,
+                                    const std::shared_ptr<verification_key>& key,
+                                    CommitmentScheme& commitment_scheme,
+                                    std::map<std::string, g1::affine_element>& kate_g1_elements,
+                                    std::map<std::string, fr>& kate_fr_elements)
 {
     // This function verifies a PLONK proof for given program settings.
     // A PLONK proof for standard PLONK is of the form:
@@ -128,7 +175,7 @@ template <typename program_settings> bool VerifierBase<program_settings>::verify
     // Note that we do not actually compute the scalar multiplications but just accumulate the scalars
     // and the group elements in different vectors.
     //
-    commitment_scheme->batch_verify(transcript, kate_g1_elements, kate_fr_elements, key);
+    commitment_scheme.batch_verify(transcript, kate_g1_elements, kate_fr_elements, key);
 
     // Step 9: Compute the partial opening batch commitment [D]_1:
     //         [D]_1 = (a_eval.b_eval.[qM]_1 + a_eval.[qL]_1 + b_eval.[qR]_1 + c_eval.[qO]_1 + [qC]_1) * nu_{linear} * α
@@ -163,27 +210,20 @@ template <typename program_settings> bool VerifierBase<program_settings>::verify
     kate_g1_elements.insert({ "PI_Z", PI_Z });
     kate_fr_elements.insert({ "PI_Z", zeta });
 
-    std::vector<fr> scalars;
-    std::vector<g1::affine_element> elements;
-
-    for (const auto& [key, value] : kate_g1_elements) {
+    pairing_claim claim;
+    for (const auto& [label, value] : kate_g1_elements) {
         // TODO: perhaps we should throw if not on curve or if infinity?
         if (value.on_curve() && !value.is_point_at_infinity()) {
-            scalars.emplace_back(kate_fr_elements.at(key));
-            elements.emplace_back(value);
+            claim.labels.emplace_back(label);
+            claim.scalars.emplace_back(kate_fr_elements.at(label));
+            claim.elements.emplace_back(value);
         }
     }
-
-    size_t num_elements = elements.size();
-    elements.resize(num_elements * 2);
-    barretenberg::scalar_multiplication::generate_pippenger_point_table<curve::BN254>(
-        &elements[0], &elements[0], num_elements);
-    scalar_multiplication::pippenger_runtime_state<curve::BN254> state(num_elements);
-
-    g1::element P[2];
-
-    P[0] = barretenberg::scalar_multiplication::pippenger<curve::BN254>(&scalars[0], &elements[0], num_elements, state);
-    P[1] = -(g1::element(PI_Z_OMEGA) * separator_challenge + PI_Z);
+    claim.PI_Z = PI_Z;
+    claim.PI_Z_OMEGA = PI_Z_OMEGA;
+    claim.separator_challenge = separator_challenge;
+    claim.P0_offset.self_set_infinity();
+    claim.P1_offset.self_set_infinity();
 
     if (key->contains_recursive_proof) {
         ASSERT(key->recursive_proof_public_input_indices.size() == 16);
@@ -220,18 +260,132 @@ template <typename program_settings> bool VerifierBase<program_settings>::verify
                                                       key->recursive_proof_public_input_indices[14],
                                                       key->recursive_proof_public_input_indices[15]);
 
-        P[0] += g1::element(x0, y0, 1) * recursion_separator_challenge;
-        P[1] += g1::element(x1, y1, 1) * recursion_separator_challenge;
+        claim.P0_offset = g1::element(x0, y0, 1) * recursion_separator_challenge;
+        claim.P1_offset = g1::element(x1, y1, 1) * recursion_separator_challenge;
     }
 
-    g1::element::batch_normalize(P, 2);
+    return claim;
+}
+} // namespace
 
-    g1::affine_element P_affine[2]{
-        { P[0].x, P[0].y },
-        { P[1].x, P[1].y },
-    };
+template <typename program_settings> bool VerifierBase<program_settings>::verify_proof(const plonk::proof& proof)
+{
+    const auto P_affine = compute_pairing_points(proof);
 
     // The final pairing check of step 12.
+    barretenberg::fq12 result = barretenberg::pairing::reduced_ate_pairing_batch_precomputed(
+        &P_affine[0], key->reference_string->get_precomputed_g2_lines(), 2);
+
+    return (result == barretenberg::fq12::one());
+}
+
+/**
+ * @brief Run every step of the verification of `proof` except the final pairing check, and return the points
+ * {P₀, P₁} of that check, e(P₀,[1]₂)e(P₁,[x]₂) ≡ [1]ₜ. The checks of independent proofs can then be batched with
+ * barretenberg::pairing::pairing_check_batch_precomputed.
+ */
+template <typename program_settings>
+std::array<g1::affine_element, 2> VerifierBase<program_settings>::compute_pairing_points(const plonk::proof& proof)
+{
+    kate_g1_elements.clear();
+    kate_fr_elements.clear();
+    auto claim = compute_pairing_claim<program_settings>(
+        proof, manifest, key, *commitment_scheme, kate_g1_elements, kate_fr_elements);
+
+    g1::element P[2];
+    P[0] = pippenger_msm(claim.scalars, claim.elements) + claim.P0_offset;
+    P[1] = -(g1::element(claim.PI_Z_OMEGA) * claim.separator_challenge + claim.PI_Z) + claim.P1_offset;
+
+    g1::element::batch_normalize(P, 2);
+
+    return { g1::affine_element{ P[0].x, P[0].y }, g1::affine_element{ P[1].x, P[1].y } };
+}
+
+/**
+ * @brief Verify several proofs against the verification key of this verifier, with a single pairing
+ *
+ * @details Everything up to the final pairing check is computed for each proof in parallel, each against its own copy
+ * of the key. The pairing claims are then combined with random weights r_i (r_0 = 1): P₀ = ∑ r_i⋅P₀_i is computed as
+ * one msm over the batch opening terms of all proofs, in which the terms of the commitments shared by all proofs (those
+ * of the verification key) are merged, and likewise for P₁. If any proof is invalid, the combined check passes with
+ * probability 1/|Fr|.
+ *
+ * Throws if any proof is malformed, as verify_proof would.
+ *
+ * @return true if every proof is valid
+ */
+template <typename program_settings>
+bool VerifierBase<program_settings>::verify_proofs(std::span<const plonk::proof> proofs)
+{
+    const size_t num_proofs = proofs.size();
+    if (num_proofs == 0) {
+        return true;
+    }
+
+    std::vector<pairing_claim> claims(num_proofs);
+    std::vector<std::exception_ptr> errors(num_proofs);
+    parallel_for(num_proofs, [&](size_t i) {
+        try {
+            auto proof_key = std::make_shared<verification_key>(*key);
+            std::map<std::string, g1::affine_element> proof_g1_elements;
+            std::map<std::string, fr> proof_fr_elements;
+            claims[i] = compute_pairing_claim<program_settings>(
+                proofs[i], manifest, proof_key, *commitment_scheme, proof_g1_elements, proof_fr_elements);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    std::vector<fr> weights(num_proofs);
+    weights[0] = fr::one();
+    for (size_t i = 1; i < num_proofs; ++i) {
+        weights[i] = fr::random_element();
+    }
+
+    std::vector<fr> P0_scalars;
+    std::vector<g1::affine_element> P0_elements;
+    std::map<std::string, size_t> first_term_of_label;
+    std::vector<fr> P1_scalars;
+    std::vector<g1::affine_element> P1_elements;
+    g1::element P0_offset;
+    g1::element P1_offset;
+    P0_offset.self_set_infinity();
+    P1_offset.self_set_infinity();
+    for (size_t i = 0; i < num_proofs; ++i) {
+        const auto& claim = claims[i];
+        for (size_t j = 0; j < claim.elements.size(); ++j) {
+            const fr scalar = claim.scalars[j] * weights[i];
+            const auto first_term = first_term_of_label.find(claim.labels[j]);
+            if (first_term != first_term_of_label.end() && P0_elements[first_term->second] == claim.elements[j]) {
+                P0_scalars[first_term->second] += scalar;
+                continue;
+            }
+            first_term_of_label.insert({ claim.labels[j], P0_elements.size() });
+            P0_scalars.emplace_back(scalar);
+            P0_elements.emplace_back(claim.elements[j]);
+        }
+        P1_scalars.emplace_back(-(claim.separator_challenge * weights[i]));
+        P1_elements.emplace_back(claim.PI_Z_OMEGA);
+        P1_scalars.emplace_back(-weights[i]);
+        P1_elements.emplace_back(claim.PI_Z);
+        if (key->contains_recursive_proof) {
+            P0_offset += claim.P0_offset * weights[i];
+            P1_offset += claim.P1_offset * weights[i];
+        }
+    }
+
+    g1::element P[2];
+    P[0] = pippenger_msm(P0_scalars, P0_elements) + P0_offset;
+    P[1] = pippenger_msm(P1_scalars, P1_elements) + P1_offset;
+    g1::element::batch_normalize(P, 2);
+    g1::affine_element P_affine[2]{ { P[0].x, P[0].y }, { P[1].x, P[1].y } };
+
+    // The final pairing check of step 12, of all proofs at once.
     barretenberg::fq12 result = barretenberg::pairing::reduced_ate_pairing_batch_precomputed(
         P_affine, key->reference_string->get_precomputed_g2_lines(), 2);
 
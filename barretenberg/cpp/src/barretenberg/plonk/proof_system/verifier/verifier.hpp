@@ -5,6 +5,8 @@
 #include "barretenberg/plonk/proof_system/commitment_scheme/commitment_scheme.hpp"
 #include "barretenberg/transcript/manifest.hpp"
 
+#include <span>
+
 namespace proof_system::plonk {
 template <typename program_settings> class VerifierBase {
 
@@ -20,6 +22,8 @@ template <typename program_settings> class VerifierBase {
     bool validate_scalars();
 
     bool verify_proof(const plonk::proof& proof);
+    bool verify_proofs(std::span<const plonk::proof> proofs);
+    std::array<barretenberg::g1::affine_element, 2> compute_pairing_points(const plonk::proof& proof);
     transcript::Manifest manifest;
 
     std::shared_ptr<verification_key> key;
@@ -3,6 +3,7 @@
 #include "barretenberg/common/slab_allocator.hpp"
 #include "barretenberg/plonk/proof_system/proving_key/proving_key.hpp"
 #include "barretenberg/plonk/proof_system/public_inputs/public_inputs.hpp"
+#include "barretenberg/polynomials/grand_product.hpp"
 #include "barretenberg/polynomials/iterate_over_domain.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
@@ -62,19 +63,6 @@ void ProverPermutationWidget<program_width, idpolys, num_roots_cut_out_of_vanish
         return;
     }
 
-    // Allocate scratch space in memory for computation of lagrange form of permutation polynomial
-    // 'z_perm'. Elements 2,...,n of z_perm are constructed in place in accumulators[0]. (The first
-    // element of z_perm is one, i.e. z_perm[0] == 1). The remaining accumulators are used only as scratch
-    // space.
-    size_t num_accumulators = (program_width == 1) ? 3 : program_width * 2;
-    std::shared_ptr<void> accumulators_ptrs[num_accumulators];
-    fr* accumulators[num_accumulators];
-    // Allocate the required number of length n scratch space arrays
-    for (size_t k = 0; k < num_accumulators; ++k) {
-        accumulators_ptrs[k] = get_mem_slab(key->circuit_size * sizeof(fr));
-        accumulators[k] = (fr*)accumulators_ptrs[k].get();
-    }
-
     barretenberg::fr beta = fr::serialize_from_buffer(transcript.get_challenge("beta").begin());
     barretenberg::fr gamma = fr::serialize_from_buffer(transcript.get_challenge("beta", 1).begin());
 
@@ -103,8 +91,6 @@ void ProverPermutationWidget<program_width, idpolys, num_roots_cut_out_of_vanish
     // When we write w_i it means the evaluation of witness polynomial at i-th index.
     // When we write w^{i} it means the generator of the subgroup to the i-th power.
     //
-    // step 1: compute the individual terms in the permutation poylnomial.
-    //
     // Consider the case in which we use identity permutation polynomials and let program width = 3.
     // (extending it to the case when the permutation polynomials is not identity is trivial).
     //
@@ -123,147 +109,50 @@ void ProverPermutationWidget<program_width, idpolys, num_roots_cut_out_of_vanish
     //                  (w_2 + γ + β.σ(2) ) . (w_{n+2} + γ + β.σ(n+2)   ) . (w_{2n+2} + γ + β.σ(2n+2)  )
     // and so on...
     //
-    // accumulator data structure:
-    // numerators are stored in accumulator[0: program_width-1],
-    // denominators are stored in accumulator[program_width:]
-    //
-    //      0                                1                                      (n-1)
-    // 0 -> (w_1      + γ + β.ω^{0}    ),    (w_2      + γ + β.ω^{1}    ),    ...., (w_n      + γ + β.ω^{n-1}    )
-    // 1 -> (w_{n+1}  + γ + β.k_1.ω^{0}),    (w_{n+1}  + γ + β.k_1.ω^{2}),    ...., (w_{n+1}  + γ + β.k_1.ω^{n-1})
-    // 2 -> (w_{2n+1} + γ + β.k_2.ω^{0}),    (w_{2n+1} + γ + β.k_2.ω^{0}),    ...., (w_{2n+1} + γ + β.k_2.ω^{n-1})
-    //
-    // 3 -> (w_1      + γ + β.σ(1)     ),    (w_2      + γ + β.σ(2)     ),    ...., (w_n      + γ + β.σ(n)       )
-    // 4 -> (w_{n+1}  + γ + β.σ(n+1)   ),    (w_{n+1}  + γ + β.σ{n+2}   ),    ...., (w_{n+1}  + γ + β.σ{n+n}     )
-    // 5 -> (w_{2n+1} + γ + β.σ(2n+1)  ),    (w_{2n+1} + γ + β.σ(2n+2)  ),    ...., (w_{2n+1} + γ + β.σ(2n+n)    )
-    //
-    // Thus, to obtain coefficient_of_L2, we need to use accumulators[:][0]:
-    //    acc[0][0]*acc[1][0]*acc[2][0] / acc[program_width][0]*acc[program_width+1][0]*acc[program_width+2][0]
-    //
-    // To obtain coefficient_of_L3, we need to use accumulator[:][0] and accumulator[:][1]
-    // and so on upto coefficient_of_Ln.
-    //
-    // Recall: In a domain: num_threads * thread_size = size (= subgroup_size)
-    //        |  0 |  1 |  2 |  3 |  4 |  5 |  6 |  7 |  8 |  9 | 10 | 11 | 12 | 13 | 14 | 15 | <-- n = 16
-    //    j:  |    0    |    1    |    2    |    3    |    4    |    5    |    6    |    7    | num_threads = 8
-    //    i:     0    1    0    1    0    1    0    1    0    1    0    1    0    1    0    1   thread_size = 2
-    // So i will access a different element from 0..(n-1) each time.
-    // Commented maths notation mirrors the indexing from the giant comment immediately above.
-    parallel_for(key->small_domain.num_threads, [&](size_t j) {
-        barretenberg::fr thread_root = key->small_domain.root.pow(
-            static_cast<uint64_t>(j * key->small_domain.thread_size));              // effectively ω^{i} in inner loop
-        [[maybe_unused]] barretenberg::fr cur_root_times_beta = thread_root * beta; // β.ω^{i}
-        barretenberg::fr T0;
-        barretenberg::fr wire_plus_gamma;
-        size_t start = j * key->small_domain.thread_size;
-        size_t end = (j + 1) * key->small_domain.thread_size;
-        for (size_t i = start; i < end; ++i) {
-            wire_plus_gamma = gamma + lagrange_base_wires[0][i]; // w_{i + 1} + γ
-                                                                 // i in 0..(n-1)
-            if constexpr (!idpolys) {
-                accumulators[0][i] = wire_plus_gamma + cur_root_times_beta; // w_{i + 1} + γ + β.ω^{i}
-            }
-            if constexpr (idpolys) {
-                T0 = lagrange_base_ids[0][i] * beta;       // β.id(i + 1)
-                accumulators[0][i] = T0 + wire_plus_gamma; // w_{i + 1} + γ + β.id(i + 1)
-            }
-
-            T0 = lagrange_base_sigmas[0][i] * beta;                // β.σ(i + 1)
-            accumulators[program_width][i] = T0 + wire_plus_gamma; // w_{i + 1} + γ + β.σ(i + 1)
-
-            for (size_t k = 1; k < program_width; ++k) {
-                wire_plus_gamma = gamma + lagrange_base_wires[k][i]; // w_{k.n + i + 1} + γ
-                                                                     // i in 0..(n-1)
+    // The numerator and denominator of the i-th quotient are computed by the term function below, and the running
+    // products of the quotients by compute_grand_product, which batch inverts the denominators a block at a time.
+    // Hence z_perm[i + 1] is the product of the first i + 1 quotients, for i in 0..(n-2).
+    polynomial z_perm(key->circuit_size);
+    z_perm[0] = fr::one();
+    barretenberg::compute_grand_product(
+        std::span{ &z_perm[1], key->circuit_size - 1 },
+        [&](size_t start, std::span<fr> numerators, std::span<fr> denominators) {
+            [[maybe_unused]] barretenberg::fr cur_root_times_beta =
+                key->small_domain.root.pow(static_cast<uint64_t>(start)) * beta; // β.ω^{i}
+            barretenberg::fr T0;
+            barretenberg::fr wire_plus_gamma;
+            for (size_t j = 0; j < numerators.size(); ++j) {
+                const size_t i = start + j;
+                wire_plus_gamma = gamma + lagrange_base_wires[0][i]; // w_{i + 1} + γ
+                if constexpr (!idpolys) {
+                    numerators[j] = wire_plus_gamma + cur_root_times_beta; // w_{i + 1} + γ + β.ω^{i}
+                }
                 if constexpr (idpolys) {
-                    T0 = lagrange_base_ids[k][i] * beta; // β.id(k.n + i + 1)
-                } else {
-                    T0 = fr::coset_generator(k - 1) * cur_root_times_beta; // β.k_{k}.ω^{i}
-                                                                           //   ^coset generator k
+                    T0 = lagrange_base_ids[0][i] * beta;  // β.id(i + 1)
+                    numerators[j] = T0 + wire_plus_gamma; // w_{i + 1} + γ + β.id(i + 1)
                 }
-                accumulators[k][i] = T0 + wire_plus_gamma; // w_{k.n + i + 1} + γ + β.id(k.n + i + 1)
 
-                T0 = lagrange_base_sigmas[k][i] * beta;                    // β.σ(k.n + i + 1)
-                accumulators[k + program_width][i] = T0 + wire_plus_gamma; // w_{k.n + i + 1} + γ + β.σ(k.n + i + 1)
-            }
-            if constexpr (!idpolys)
-                cur_root_times_beta *= key->small_domain.root; // β.ω^{i + 1}
-        }
-    });
-
-    // Step 2: compute the constituent components of z(X). This is a small multithreading bottleneck, as we have
-    // program_width * 2 non-parallelizable processes
-    //
-    // Update the accumulator matrix a[:][:] to contain the left products like so:
-    //      0           1                     2                          (n-1)
-    // 0 -> (a[0][0]),  (a[0][1] * a[0][0]),  (a[0][2] * a[0][1]), ...,  (a[0][n-1] * a[0][n-2])
-    // 1 -> (a[1][0]),  (a[1][1] * a[1][0]),  (a[1][2] * a[1][1]), ...,  (a[1][n-1] * a[1][n-2])
-    // 2 -> (a[2][0]),  (a[2][1] * a[2][0]),  (a[2][2] * a[2][1]), ...,  (a[2][n-1] * a[2][n-2])
-    //
-    // 3 -> (a[3][0]),  (a[3][1] * a[3][0]),  (a[3][2] * a[3][1]), ...,  (a[3][n-1] * a[3][n-2])
-    // 4 -> (a[4][0]),  (a[4][1] * a[4][0]),  (a[4][2] * a[4][1]), ...,  (a[4][n-1] * a[4][n-2])
-    // 5 -> (a[5][0]),  (a[5][1] * a[5][0]),  (a[5][2] * a[5][1]), ...,  (a[5][n-1] * a[5][n-2])
-    //
-    // and so on...
-    parallel_for(program_width * 2, [&](size_t i) {
-        fr* coeffs = &accumulators[i][0]; // start from the beginning of a row
-        for (size_t j = 0; j < key->small_domain.size - 1; ++j) {
-            coeffs[j + 1] *= coeffs[j]; // iteratively update elements in subsequent columns
-        }
-    });
-
-    // step 3: concatenate together the accumulator elements into z(X)
-    //
-    // Update each element of the accumulator row a[0] to be the product of itself with the 'numerator' rows beneath
-    // it, and update each element of a[program_width] to be the product of itself with the 'denominator' rows
-    // beneath it.
-    //
-    //       0                                     1                                           (n-1)
-    // 0 ->  (a[0][0] * a[1][0] * a[2][0]),        (a[0][1] * a[1][1] * a[2][1]),        ...., (a[0][n-1] *
-    // a[1][n-1] * a[2][n-1])
-    //
-    // pw -> (a[pw][0] * a[pw+1][0] * a[pw+2][0]), (a[pw][1] * a[pw+1][1] * a[pw+2][1]), ...., (a[pw][n-1] *
-    // a[pw+1][n-1] * a[pw+2][n-1])
-    //
-    // Note that pw = program_width
-    //
-    // Hereafter, we can compute
-    // coefficient_Lj = a[0][j]/a[pw][j]
-    //
-    // Naive way of computing these coefficients would result in n inversions, which is pretty expensive.
-    // Instead we use Montgomery's trick for batch inversion.
-    // Montgomery's trick documentation:
-    // ./src/barretenberg/ecc/curves/bn254/scalar_multiplication/scalar_multiplication.hpp/L286
-    parallel_for(key->small_domain.num_threads, [&](size_t j) {
-        const size_t start = j * key->small_domain.thread_size;
-        const size_t end =
-            ((j + 1) * key->small_domain.thread_size) - ((j == key->small_domain.num_threads - 1) ? 1 : 0);
-        barretenberg::fr inversion_accumulator = fr::one();
-        constexpr size_t inversion_index = (program_width == 1) ? 2 : program_width * 2 - 1;
-        fr* inversion_coefficients = &accumulators[inversion_index][0];
-        for (size_t i = start; i < end; ++i) {
-
-            for (size_t k = 1; k < program_width; ++k) {
-                accumulators[0][i] *= accumulators[k][i];
-                accumulators[program_width][i] *= accumulators[program_width + k][i];
+                T0 = lagrange_base_sigmas[0][i] * beta; // β.σ(i + 1)
+                denominators[j] = T0 + wire_plus_gamma; // w_{i + 1} + γ + β.σ(i + 1)
+
+                for (size_t k = 1; k < program_width; ++k) {
+                    wire_plus_gamma = gamma + lagrange_base_wires[k][i]; // w_{k.n + i + 1} + γ
+                    if constexpr (idpolys) {
+                        T0 = lagrange_base_ids[k][i] * beta; // β.id(k.n + i + 1)
+                    } else {
+                        T0 = fr::coset_generator(k - 1) * cur_root_times_beta; // β.k_{k}.ω^{i}
+                                                                               //   ^coset generator k
+                    }
+                    numerators[j] *= T0 + wire_plus_gamma; // w_{k.n + i + 1} + γ + β.id(k.n + i + 1)
+
+                    T0 = lagrange_base_sigmas[k][i] * beta;  // β.σ(k.n + i + 1)
+                    denominators[j] *= T0 + wire_plus_gamma; // w_{k.n + i + 1} + γ + β.σ(k.n + i + 1)
+                }
+                if constexpr (!idpolys) {
+                    cur_root_times_beta *= key->small_domain.root; // β.ω^{i + 1}
+                }
             }
-            inversion_coefficients[i] = accumulators[0][i] * inversion_accumulator;
-            inversion_accumulator *= accumulators[program_width][i];
-        }
-        inversion_accumulator = inversion_accumulator.invert();
-        for (size_t i = end - 1; i != start - 1; --i) {
-
-            // N.B. accumulators[0][i] = z_perm[i + 1]
-            // We can avoid fully reducing z_perm[i + 1] as the inverse fft will take care of that for us
-            accumulators[0][i] = inversion_accumulator * inversion_coefficients[i];
-            inversion_accumulator *= accumulators[program_width][i];
-        }
-    });
-
-    // Construct permutation polynomial 'z' in lagrange form as:
-    // z = [1 accumulators[0][0] accumulators[0][1] ... accumulators[0][n-2]]
-    polynomial z_perm(key->circuit_size);
-    z_perm[0] = fr::one();
-    barretenberg::polynomial_arithmetic::copy_polynomial(
-        accumulators[0], &z_perm[1], key->circuit_size - 1, key->circuit_size - 1);
+        });
 
     /*
     Adding zero knowledge to the permutation polynomial.
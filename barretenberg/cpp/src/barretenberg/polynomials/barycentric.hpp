@@ -116,11 +116,27 @@ template <class Fr, size_t domain_size, size_t num_evals> class BarycentricDataC
         return result;
     }
 
+    // the coefficient of v_j in f(x_k), B(x_k) / (d_j*(x_k - x_j)), so that extending to x_k is a dot product with
+    // the values on the domain
+    static constexpr std::array<Fr, domain_size * num_evals> construct_extension_coefficients(
+        const auto& denominator_inverses, const auto& numerator_values)
+    {
+        std::array<Fr, domain_size * num_evals> result{};
+        for (size_t k = domain_size; k < num_evals; ++k) {
+            for (size_t j = 0; j < domain_size; ++j) {
+                result[k * domain_size + j] = denominator_inverses[k * domain_size + j] * numerator_values[k];
+            }
+        }
+        return result;
+    }
+
     static constexpr auto big_domain = construct_big_domain();
     static constexpr auto lagrange_denominators = construct_lagrange_denominators(big_domain);
     static constexpr auto precomputed_denominator_inverses =
         construct_denominator_inverses(big_domain, lagrange_denominators);
     static constexpr auto full_numerator_values = construct_full_numerator_values(big_domain);
+    static constexpr auto extension_coefficients =
+        construct_extension_coefficients(precomputed_denominator_inverses, full_numerator_values);
 
     /**
      * @brief Given a univariate f represented by {f(0), ..., f(t-1)}, compute {f(t), ..., f(u-1)}
@@ -133,6 +149,9 @@ template <class Fr, size_t domain_size, size_t num_evals> class BarycentricDataC
      *      - B(x) = Π_{i=0}^{t-1} (x-x_i)
      *      - d_i  = Π_{j ∈ {0, ..., t-1}, j≠i} (x_i-x_j) for i ∈ {0, ..., t-1}
      *
+     * The factors B(x_k) / (d_i*(x_k-x_i)) are precomputed for each x_k, so each new value is a dot product with the
+     * values on the domain.
+     *
      * When the domain size is two, extending f = v0(1-X) + v1X to a new value involves just one addition and a
      * subtraction: setting Δ = v1-v0, the values of f(X) are f(0)=v0, f(1)= v0 + Δ, v2 = f(1) + Δ, v3 = f(2) + Δ...
      *
@@ -142,30 +161,38 @@ template <class Fr, size_t domain_size, size_t num_evals> class BarycentricDataC
         static_assert(num_evals >= domain_size);
         Univariate<Fr, num_evals> result;
 
-        std::copy(f.evaluations.begin(), f.evaluations.end(), result.evaluations.begin());
-
         if constexpr (domain_size == 2) {
-            Fr delta = f.value_at(1) - f.value_at(0);
-            for (size_t idx = 1; idx < num_evals - 1; idx++) {
-                result.value_at(idx + 1) = result.value_at(idx) + delta;
-            }
+            extend_edge(f.value_at(0), f.value_at(1), result);
             return result;
         } else {
+            std::copy(f.evaluations.begin(), f.evaluations.end(), result.evaluations.begin());
             for (size_t k = domain_size; k != num_evals; ++k) {
-                result.value_at(k) = 0;
-                // compute each term v_j / (d_j*(x-x_j)) of the sum
-                for (size_t j = 0; j != domain_size; ++j) {
-                    Fr term = f.value_at(j);
-                    term *= precomputed_denominator_inverses[domain_size * k + j];
-                    result.value_at(k) += term;
+                result.value_at(k) = f.value_at(0) * extension_coefficients[domain_size * k];
+                for (size_t j = 1; j != domain_size; ++j) {
+                    result.value_at(k) += f.value_at(j) * extension_coefficients[domain_size * k + j];
                 }
-                // scale the sum by the the value of of B(x)
-                result.value_at(k) *= full_numerator_values[k];
             }
             return result;
         }
     }
 
+    /**
+     * @brief Extend the linear univariate taking values v0, v1 on {0, 1} into result, without building it first
+     *
+     * @details This is how the sumcheck prover extends the edges of each polynomial, which is done for every edge of
+     * every round.
+     */
+    static void extend_edge(const Fr& v0, const Fr& v1, Univariate<Fr, num_evals>& result)
+        requires(domain_size == 2)
+    {
+        result.value_at(0) = v0;
+        result.value_at(1) = v1;
+        Fr delta = v1 - v0;
+        for (size_t idx = 1; idx < num_evals - 1; idx++) {
+            result.value_at(idx + 1) = result.value_at(idx) + delta;
+        }
+    }
+
     /**
      * @brief Evaluate a univariate at a point u not known at compile time
      * and assumed not to be in the domain (else we divide by zero).
@@ -297,11 +324,27 @@ template <class Fr, size_t domain_size, size_t num_evals> class BarycentricDataR
         return result;
     }
 
+    // the coefficient of v_j in f(x_k), B(x_k) / (d_j*(x_k - x_j)), so that extending to x_k is a dot product with
+    // the values on the domain
+    static std::array<Fr, domain_size * num_evals> construct_extension_coefficients(const auto& denominator_inverses,
+                                                                                    const auto& numerator_values)
+    {
+        std::array<Fr, domain_size * num_evals> result{};
+        for (size_t k = domain_size; k < num_evals; ++k) {
+            for (size_t j = 0; j < domain_size; ++j) {
+                result[k * domain_size + j] = denominator_inverses[k * domain_size + j] * numerator_values[k];
+            }
+        }
+        return result;
+    }
+
     inline static const auto big_domain = construct_big_domain();
     inline static const auto lagrange_denominators = construct_lagrange_denominators(big_domain);
     inline static const auto precomputed_denominator_inverses =
         construct_denominator_inverses(big_domain, lagrange_denominators);
     inline static const auto full_numerator_values = construct_full_numerator_values(big_domain);
+    inline static const auto extension_coefficients =
+        construct_extension_coefficients(precomputed_denominator_inverses, full_numerator_values);
 
     /**
      * @brief Given a univariate f represented by {f(0), ..., f(t-1)}, compute {f(t), ..., f(u-1)}
@@ -314,6 +357,9 @@ template <class Fr, size_t domain_size, size_t num_evals> class BarycentricDataR
      *      - B(x) = Π_{i=0}^{t-1} (x-x_i)
      *      - d_i  = Π_{j ∈ {0, ..., t-1}, j≠i} (x_i-x_j) for i ∈ {0, ..., t-1}
      *
+     * The factors B(x_k) / (d_i*(x_k-x_i)) are precomputed for each x_k, so each new value is a dot product with the
+     * values on the domain.
+     *
      * When the domain size is two, extending f = v0(1-X) + v1X to a new value involves just one addition and a
      * subtraction: setting Δ = v1-v0, the values of f(X) are f(0)=v0, f(1)= v0 + Δ, v2 = f(1) + Δ, v3 = f(2) + Δ...
      *
@@ -332,20 +378,11 @@ template <class Fr, size_t domain_size, size_t num_evals> class BarycentricDataR
             }
             return result;
         } else {
-            for (size_t k = 0; k != domain_size; ++k) {
-                result.value_at(k) = f.value_at(k);
-            }
-
             for (size_t k = domain_size; k != num_evals; ++k) {
-                result.value_at(k) = 0;
-                // compute each term v_j / (d_j*(x-x_j)) of the sum
-                for (size_t j = 0; j != domain_size; ++j) {
-                    Fr term = f.value_at(j);
-                    term *= precomputed_denominator_inverses[domain_size * k + j];
-                    result.value_at(k) += term;
+                result.value_at(k) = f.value_at(0) * extension_coefficients[domain_size * k];
+                for (size_t j = 1; j != domain_size; ++j) {
+                    result.value_at(k) += f.value_at(j) * extension_coefficients[domain_size * k + j];
                 }
-                // scale the sum by the the value of of B(x)
-                result.value_at(k) *= full_numerator_values[k];
             }
             return result;
         }
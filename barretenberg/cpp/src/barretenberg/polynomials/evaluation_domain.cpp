@@ -1,13 +1,16 @@
 #include "evaluation_domain.hpp"
 #include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/mem.hpp"
+#include "barretenberg/common/proof_arena.hpp"
 #include "barretenberg/common/slab_allocator.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/proof_system/types/circuit_type.hpp"
+#include <map>
 #include <memory.h>
 #include <memory>
+#include <mutex>
 
 namespace barretenberg {
 
@@ -37,16 +40,89 @@ void compute_lookup_table_single(const Fr& input_root,
         round_roots.emplace_back(round_roots.back() + (1UL << i));
     }
 
-    for (size_t i = 0; i < num_rounds - 1; ++i) {
+    // The last round holds the powers ω^j, j < n/2, which are computed in parallel. The round with m roots holds every
+    // (n/2m)th of them.
+    const size_t num_threads = compute_num_threads(size / 2);
+    const size_t thread_size = (size / 2) / num_threads;
+    Fr* const last_round_roots = round_roots.back();
+    parallel_for(num_threads, [&](size_t j) {
+        Fr work_root = input_root.pow(static_cast<uint64_t>(j * thread_size));
+        for (size_t i = j * thread_size; i < (j + 1) * thread_size; ++i) {
+            last_round_roots[i] = work_root;
+            work_root *= input_root;
+        }
+    });
+    for (size_t i = 0; i + 2 < num_rounds; ++i) {
         const size_t m = 1UL << (i + 1);
-        const Fr round_root = input_root.pow(static_cast<uint64_t>(size / (2 * m)));
+        const size_t stride = size / (2 * m);
         Fr* const current_round_roots = round_roots[i];
-        current_round_roots[0] = Fr::one();
-        for (size_t j = 1; j < m; ++j) {
-            current_round_roots[j] = current_round_roots[j - 1] * round_root;
+        for (size_t j = 0; j < m; ++j) {
+            current_round_roots[j] = last_round_roots[j * stride];
+        }
+    }
+}
+
+template <typename Fr>
+void compute_radix_4_lookup_table(const size_t log2_size, const std::vector<Fr*>& round_roots, std::vector<Fr>& roots)
+{
+    // The six-step fft splits the domain into ffts of size at most 2^⌈log(n)/2⌉, whose last butterflies combine
+    // four ffts of size m = 2^(⌈log(n)/2⌉ - 2)
+    const size_t max_m = 1UL << ((log2_size + 1) / 2 - 2);
+    roots.resize(3 * (2 * max_m - 1));
+    for (size_t m = 1; m <= max_m; m <<= 1) {
+        const size_t log2_m = static_cast<size_t>(numeric::get_msb(m));
+        Fr* const current_roots = &roots[3 * (m - 1)];
+        for (size_t j = 0; j < m; ++j) {
+            current_roots[3 * j] = (m == 1) ? Fr::one() : round_roots[log2_m - 1][j];
+            current_roots[3 * j + 1] = round_roots[log2_m][j];
+            current_roots[3 * j + 2] = round_roots[log2_m][j + m];
         }
     }
 }
+
+template <typename Fr>
+std::shared_ptr<const EvaluationDomainLookupTables<Fr>> compute_lookup_tables(const Fr& root,
+                                                                              const Fr& root_inverse,
+                                                                              const size_t size)
+{
+    const size_t log2_size = static_cast<size_t>(numeric::get_msb(size));
+    // The tables are shared by the domains of this size of every key in the process, so they are not allocated from
+    // the arena of the proof that happens to compute them.
+    ProofArena::Scope heap_scope(nullptr);
+    auto tables = std::make_shared<EvaluationDomainLookupTables<Fr>>();
+    tables->roots = std::static_pointer_cast<Fr[]>(get_mem_slab(sizeof(Fr) * size * 2));
+    compute_lookup_table_single(root, size, tables->roots.get(), tables->round_roots);
+    compute_lookup_table_single(root_inverse, size, &tables->roots.get()[size], tables->inverse_round_roots);
+    // the six-step fft needs ffts of size at least 4 on either side
+    if (log2_size >= 4) {
+        compute_radix_4_lookup_table(log2_size, tables->round_roots, tables->radix_4_roots);
+        compute_radix_4_lookup_table(log2_size, tables->inverse_round_roots, tables->inverse_radix_4_roots);
+    }
+    return tables;
+}
+
+/**
+ * Get the lookup tables of the domain of the given size: the ones computed for another domain of this size, if that
+ * is still alive, or new ones. The registry only holds weak references, the tables are freed with the last domain
+ * using them.
+ */
+template <typename Fr>
+std::shared_ptr<const EvaluationDomainLookupTables<Fr>> get_shared_lookup_tables(const Fr& root,
+                                                                                 const Fr& root_inverse,
+                                                                                 const size_t size)
+{
+    static std::mutex registry_mutex;
+    static std::map<size_t, std::weak_ptr<const EvaluationDomainLookupTables<Fr>>> registry;
+
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    auto& entry = registry[size];
+    auto tables = entry.lock();
+    if (tables == nullptr) {
+        tables = compute_lookup_tables(root, root_inverse, size);
+        entry = tables;
+    }
+    return tables;
+}
 } // namespace
 
 template <typename Fr>
@@ -63,7 +139,8 @@ EvaluationDomain<Fr>::EvaluationDomain(const size_t domain_size, const size_t ta
     , generator(Fr::coset_generator(0))
     , generator_inverse(Fr::coset_generator(0).invert())
     , four_inverse(Fr(4).invert())
-    , roots(nullptr)
+    , fft_algorithm(domain_size >= SIX_STEP_FFT_MIN_SIZE ? FftAlgorithm::SIX_STEP : FftAlgorithm::RADIX_2)
+    , lookup_tables(nullptr)
 {
     // Grumpkin does not have many roots of unity and, given these are not used for Honk, we set it to one.
     if (proof_system::IsAnyOf<Fr, grumpkin::fr>) {
@@ -95,25 +172,12 @@ EvaluationDomain<Fr>::EvaluationDomain(const EvaluationDomain& other)
     , generator(other.generator)
     , generator_inverse(other.generator_inverse)
     , four_inverse(other.four_inverse)
+    , fft_algorithm(other.fft_algorithm)
+    , lookup_tables(other.lookup_tables)
 {
     ASSERT((1UL << log2_size) == size);
     ASSERT((1UL << log2_thread_size) == thread_size);
     ASSERT((1UL << log2_num_threads) == num_threads);
-    if (other.roots != nullptr) {
-        const size_t mem_size = sizeof(Fr) * size * 2;
-        roots = std::static_pointer_cast<Fr[]>(get_mem_slab(mem_size));
-        memcpy(static_cast<void*>(roots.get()), static_cast<void*>(other.roots.get()), mem_size);
-        round_roots.resize(log2_size - 1);
-        inverse_round_roots.resize(log2_size - 1);
-        round_roots[0] = &roots[0];
-        inverse_round_roots[0] = &roots.get()[size];
-        for (size_t i = 1; i < log2_size - 1; ++i) {
-            round_roots[i] = round_roots[i - 1] + (1UL << i);
-            inverse_round_roots[i] = inverse_round_roots[i - 1] + (1UL << i);
-        }
-    } else {
-        roots = nullptr;
-    }
 }
 
 template <typename Fr>
@@ -132,12 +196,9 @@ EvaluationDomain<Fr>::EvaluationDomain(EvaluationDomain&& other)
     , generator(other.generator)
     , generator_inverse(other.generator_inverse)
     , four_inverse(other.four_inverse)
-{
-    roots = other.roots;
-    round_roots = std::move(other.round_roots);
-    inverse_round_roots = std::move(other.inverse_round_roots);
-    other.roots = nullptr;
-}
+    , fft_algorithm(other.fft_algorithm)
+    , lookup_tables(std::move(other.lookup_tables))
+{}
 
 template <typename Fr> EvaluationDomain<Fr>& EvaluationDomain<Fr>::operator=(EvaluationDomain&& other)
 {
@@ -155,25 +216,23 @@ template <typename Fr> EvaluationDomain<Fr>& EvaluationDomain<Fr>::operator=(Eva
     Fr::__copy(other.generator, generator);
     Fr::__copy(other.generator_inverse, generator_inverse);
     Fr::__copy(other.four_inverse, four_inverse);
-    roots = nullptr;
-    if (other.roots != nullptr) {
-        roots = other.roots;
-        round_roots = std::move(other.round_roots);
-        inverse_round_roots = std::move(other.inverse_round_roots);
-    }
-    other.roots = nullptr;
+    fft_algorithm = other.fft_algorithm;
+    lookup_tables = std::move(other.lookup_tables);
     return *this;
 }
 
 template <typename Fr> EvaluationDomain<Fr>::~EvaluationDomain() {}
 
+/**
+ * @brief Get the roots of unity lookup tables of this domain
+ *
+ * @details The tables are shared, read-only, by all of the domains of this size in the process (and by their copies),
+ * and only computed if there are none yet.
+ */
 template <typename Fr> void EvaluationDomain<Fr>::compute_lookup_table()
 {
-    ASSERT(roots == nullptr);
-    // roots = (Fr*)(aligned_alloc(32, sizeof(Fr) * size * 2));
-    roots = std::static_pointer_cast<Fr[]>(get_mem_slab(sizeof(Fr) * size * 2));
-    compute_lookup_table_single(root, size, roots.get(), round_roots);
-    compute_lookup_table_single(root_inverse, size, &roots.get()[size], inverse_round_roots);
+    ASSERT(lookup_tables == nullptr);
+    lookup_tables = get_shared_lookup_tables(root, root_inverse, size);
 }
 
 // explicitly instantiate both EvaluationDomain
@@ -1,10 +1,46 @@
 #pragma once
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <memory>
 #include <vector>
 
 namespace barretenberg {
 
+/**
+ * @brief The fft kernels of polynomial_arithmetic.
+ *
+ * RADIX_2: log(n) radix-2 butterfly passes over the whole domain.
+ * SIX_STEP: the domain is viewed as an n₁ x n₂ matrix, and the fft is computed as n₁ ffts of size n₂ and n₂ ffts of
+ * size n₁, separated by transposes. Each of the small ffts runs in cache, with radix-4 butterflies, so that the
+ * whole fft makes a handful of passes over memory instead of log(n).
+ */
+enum class FftAlgorithm { RADIX_2, SIX_STEP };
+
+/**
+ * @brief The roots of unity lookup tables of the ffts over a domain.
+ *
+ * They only depend on the field and the size of the domain, and are never modified once computed, so that all of the
+ * domains of one size in the process share one instance (see EvaluationDomain::compute_lookup_table).
+ */
+template <typename FF> struct EvaluationDomainLookupTables {
+    std::vector<FF*> round_roots; // An entry for each of the log(n) rounds: each entry is a pointer to
+                                  // the subset of the roots of unity required for that fft round.
+                                  // E.g. round_roots[0] = [1, ω^(n/2 - 1)],
+                                  //      round_roots[1] = [1, ω^(n/4 - 1), ω^(n/2 - 1), ω^(3n/4 - 1)]
+                                  //      ...
+    std::vector<FF*> inverse_round_roots;
+
+    std::vector<FF> radix_4_roots; // The roots of the radix-4 butterflies of the ffts of size up to 2^⌈log(n)/2⌉
+                                   // that make up a six-step fft. For each m = 1, 2, 4, ..., the butterflies
+                                   // combining four ffts of size m use the m triples starting at 3(m - 1):
+                                   //      (ω_{2m}^j, ω_{4m}^j, ω_{4m}^{j + m}), j = 0, ..., m - 1
+                                   // These are entries of round_roots, interleaved so that each butterfly reads
+                                   // its roots from one place.
+    std::vector<FF> inverse_radix_4_roots;
+
+    std::shared_ptr<FF[]> roots;
+};
+
 template <typename FF> class EvaluationDomain {
   public:
     EvaluationDomain()
@@ -22,7 +58,8 @@ template <typename FF> class EvaluationDomain {
         , generator(FF::zero())
         , generator_inverse(FF::zero())
         , four_inverse(FF::zero())
-        , roots(nullptr){};
+        , fft_algorithm(FftAlgorithm::RADIX_2)
+        , lookup_tables(nullptr){};
 
     EvaluationDomain(const size_t domain_size, const size_t target_generator_size = 0);
     EvaluationDomain(const EvaluationDomain& other);
@@ -36,8 +73,14 @@ template <typename FF> class EvaluationDomain {
     void compute_lookup_table();
     void compute_generator_table(const size_t target_generator_size);
 
-    const std::vector<FF*>& get_round_roots() const { return round_roots; };
-    const std::vector<FF*>& get_inverse_round_roots() const { return inverse_round_roots; }
+    const std::vector<FF*>& get_round_roots() const { return get_lookup_tables().round_roots; };
+    const std::vector<FF*>& get_inverse_round_roots() const { return get_lookup_tables().inverse_round_roots; }
+    const std::vector<FF>& get_radix_4_roots() const { return get_lookup_tables().radix_4_roots; }
+    const std::vector<FF>& get_inverse_radix_4_roots() const { return get_lookup_tables().inverse_radix_4_roots; }
+
+    // Domains of at least this size use the six-step fft by default. Below it, the radix-2 rounds mostly run in cache
+    // and the transposes do not pay for themselves (see fft_kernel_bench in polynomials.bench.cpp).
+    static constexpr size_t SIX_STEP_FFT_MIN_SIZE = 1UL << 18;
 
     size_t size;        // n, always a power of 2
     size_t num_threads; // num_threads * thread_size = size
@@ -55,15 +98,17 @@ template <typename FF> class EvaluationDomain {
     FF generator_inverse;
     FF four_inverse;
 
+    FftAlgorithm fft_algorithm;
+
   private:
-    std::vector<FF*> round_roots; // An entry for each of the log(n) rounds: each entry is a pointer to
-                                  // the subset of the roots of unity required for that fft round.
-                                  // E.g. round_roots[0] = [1, ω^(n/2 - 1)],
-                                  //      round_roots[1] = [1, ω^(n/4 - 1), ω^(n/2 - 1), ω^(3n/4 - 1)]
-                                  //      ...
-    std::vector<FF*> inverse_round_roots;
+    const EvaluationDomainLookupTables<FF>& get_lookup_tables() const
+    {
+        static const EvaluationDomainLookupTables<FF> no_lookup_tables;
+        return lookup_tables ? *lookup_tables : no_lookup_tables;
+    }
 
-    std::shared_ptr<FF[]> roots;
+    // Shared with every other domain of this size, see compute_lookup_table
+    std::shared_ptr<const EvaluationDomainLookupTables<FF>> lookup_tables;
 };
 
 // tell the compiler we will take care of instantiating these in the .cpp file
@@ -0,0 +1,77 @@
+#pragma once
+#include "barretenberg/common/thread.hpp"
+#include <algorithm>
+#include <span>
+#include <vector>
+
+namespace barretenberg {
+
+// The number of terms computed and inverted at once by compute_grand_product, small enough for them to stay in cache
+static constexpr size_t GRAND_PRODUCT_BLOCK_SIZE = 1UL << 11;
+// Below this many terms per thread, compute_grand_product uses fewer threads
+static constexpr size_t GRAND_PRODUCT_MIN_CHUNK_SIZE = 1UL << 12;
+
+/**
+ * @brief Compute the running products of the quotients of numerator and denominator terms,
+ *
+ *      result[i] = ∏_{j ≤ i} numerator(j) / denominator(j),  for i = 0, ..., result.size() - 1
+ *
+ * @details compute_terms(start, numerators, denominators) sets numerators[k] and denominators[k] to the terms of index
+ * start + k. Each thread computes a contiguous chunk of result, one block of GRAND_PRODUCT_BLOCK_SIZE indices at a
+ * time: the numerators are written straight to result and the denominators to a block of scratch space, which is
+ * batch inverted and multiplied into result along with the running product of the chunk. Hence neither the numerators
+ * nor the denominators are stored in full, and each block is read while it is still in cache. The chunks are then
+ * scaled by the product of the chunks preceding them.
+ *
+ * The inverse of a zero denominator is taken to be zero, as in batch_invert.
+ *
+ * @param compute_terms Called with consecutive blocks of a chunk, in order, so it may carry state from one index to
+ * the next within a block (e.g. a power of a root of unity), but must compute the first terms of a block from start.
+ */
+template <typename Fr, typename ComputeTerms>
+void compute_grand_product(std::span<Fr> result, const ComputeTerms& compute_terms)
+{
+    const size_t size = result.size();
+    const size_t num_chunks = std::min(get_num_cpus(), std::max<size_t>(size / GRAND_PRODUCT_MIN_CHUNK_SIZE, 1));
+    const size_t chunk_size = (size + num_chunks - 1) / num_chunks;
+
+    std::vector<Fr> chunk_products(num_chunks, Fr::one());
+    parallel_for(num_chunks, [&](size_t chunk_idx) {
+        const size_t chunk_start = std::min(chunk_idx * chunk_size, size);
+        const size_t chunk_end = std::min(chunk_start + chunk_size, size);
+        std::vector<Fr> denominators(std::min(GRAND_PRODUCT_BLOCK_SIZE, chunk_end - chunk_start));
+
+        Fr running_product = Fr::one();
+        for (size_t start = chunk_start; start < chunk_end; start += GRAND_PRODUCT_BLOCK_SIZE) {
+            const size_t block_size = std::min(GRAND_PRODUCT_BLOCK_SIZE, chunk_end - start);
+            auto numerators = result.subspan(start, block_size);
+            auto block_denominators = std::span{ denominators }.first(block_size);
+            compute_terms(start, numerators, block_denominators);
+
+            Fr::batch_invert(block_denominators);
+            for (size_t i = 0; i < block_size; ++i) {
+                running_product *= numerators[i] * block_denominators[i];
+                numerators[i] = running_product;
+            }
+        }
+        chunk_products[chunk_idx] = running_product;
+    });
+
+    // chunk_scalings[j] = ∏_{k < j} chunk_products[k]
+    std::vector<Fr> chunk_scalings(num_chunks, Fr::one());
+    for (size_t j = 1; j < num_chunks; ++j) {
+        chunk_scalings[j] = chunk_scalings[j - 1] * chunk_products[j - 1];
+    }
+    parallel_for(num_chunks, [&](size_t chunk_idx) {
+        if (chunk_idx == 0) {
+            return;
+        }
+        const size_t chunk_start = std::min(chunk_idx * chunk_size, size);
+        const size_t chunk_end = std::min(chunk_start + chunk_size, size);
+        for (size_t i = chunk_start; i < chunk_end; ++i) {
+            result[i] *= chunk_scalings[chunk_idx];
+        }
+    });
+}
+
+} // namespace barretenberg
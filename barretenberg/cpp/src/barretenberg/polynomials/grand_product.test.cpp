@@ -0,0 +1,55 @@
+#include "grand_product.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include <gtest/gtest.h>
+
+namespace barretenberg::test_grand_product {
+
+using FF = barretenberg::fr;
+
+// Compare against the running product computed one inversion at a time, over sizes spanning several blocks and chunks
+TEST(GrandProduct, MatchesRunningProductOfQuotients)
+{
+    for (size_t size : { size_t(1), GRAND_PRODUCT_BLOCK_SIZE + 3, 5 * GRAND_PRODUCT_MIN_CHUNK_SIZE + 7 }) {
+        std::vector<FF> numerators(size);
+        std::vector<FF> denominators(size);
+        for (size_t i = 0; i < size; ++i) {
+            numerators[i] = FF::random_element();
+            denominators[i] = FF::random_element();
+        }
+
+        std::vector<FF> result(size);
+        compute_grand_product(std::span{ result }, [&](size_t start, std::span<FF> num, std::span<FF> den) {
+            for (size_t j = 0; j < num.size(); ++j) {
+                num[j] = numerators[start + j];
+                den[j] = denominators[start + j];
+            }
+        });
+
+        FF expected = 1;
+        for (size_t i = 0; i < size; ++i) {
+            expected *= numerators[i] * denominators[i].invert();
+            EXPECT_EQ(result[i], expected);
+        }
+    }
+}
+
+TEST(GrandProduct, ZeroDenominatorZeroesProduct)
+{
+    const size_t size = 3 * GRAND_PRODUCT_BLOCK_SIZE;
+    const size_t zero_index = GRAND_PRODUCT_BLOCK_SIZE + 1;
+
+    std::vector<FF> result(size);
+    compute_grand_product(std::span{ result }, [&](size_t start, std::span<FF> num, std::span<FF> den) {
+        for (size_t j = 0; j < num.size(); ++j) {
+            num[j] = 2;
+            den[j] = (start + j == zero_index) ? 0 : 1;
+        }
+    });
+
+    EXPECT_EQ(result[zero_index - 1], FF(2).pow(zero_index));
+    for (size_t i = zero_index; i < size; ++i) {
+        EXPECT_EQ(result[i], FF(0));
+    }
+}
+
+} // namespace barretenberg::test_grand_product
@@ -3,6 +3,7 @@
 #include "barretenberg/common/slab_allocator.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/thread_utils.hpp"
+#include "barretenberg/ecc/fields/field_vector.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
 #include "polynomial_arithmetic.hpp"
 #include <cstddef>
@@ -57,6 +58,14 @@ Polynomial<Fr>::Polynomial(Polynomial<Fr>&& other) noexcept
     // info("Move ctor Polynomial took ownership of ", coefficients_, " size ", size_);
 }
 
+template <typename Fr>
+Polynomial<Fr>::Polynomial(pointer coefficients, const size_t initial_size)
+    : coefficients_(std::move(coefficients))
+    , size_(initial_size)
+{
+    ASSERT(coefficients_.get()[size_].is_zero());
+}
+
 template <typename Fr>
 Polynomial<Fr>::Polynomial(std::span<const Fr> coefficients)
     : size_(coefficients.size())
@@ -316,9 +325,8 @@ template <typename Fr> void Polynomial<Fr>::add_scaled(std::span<const Fr> other
     parallel_for(num_threads, [&](size_t j) {
         size_t offset = j * range_per_thread;
         size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            coefficients_.get()[i] += scaling_factor * other[i];
-        }
+        field_vector::add_scaled<Fr>(
+            other.subspan(offset, end - offset), scaling_factor, { coefficients_.get() + offset, end - offset });
     });
 }
 
@@ -370,9 +378,8 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator*=(const Fr scali
     parallel_for(num_threads, [&](size_t j) {
         size_t offset = j * range_per_thread;
         size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            coefficients_.get()[i] *= scaling_factor;
-        }
+        std::span<Fr> range{ coefficients_.get() + offset, end - offset };
+        field_vector::mul<Fr>(range, scaling_factor, range);
     });
 
     return *this;
@@ -30,6 +30,12 @@ template <typename Fr> class Polynomial {
     // Create a polynomial from the given fields.
     Polynomial(std::span<const Fr> coefficients);
 
+    /**
+     * @brief Use the given memory, of size + 1 coefficients the last of which is zero, without a copy (e.g. a polynomial
+     * mapped from a PolynomialFile)
+     */
+    Polynomial(pointer coefficients, const size_t initial_size);
+
     // Allow polynomials to be entirely reset/dormant
     Polynomial() = default;
 
@@ -3,11 +3,15 @@
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/slab_allocator.hpp"
 #include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/fields/field_vector.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "iterate_over_domain.hpp"
+#include <algorithm>
+#include <array>
 #include <math.h>
 #include <memory.h>
 #include <memory>
+#include <span>
 
 namespace barretenberg::polynomial_arithmetic {
 
@@ -16,14 +20,17 @@ namespace {
 template <typename Fr> std::shared_ptr<Fr[]> get_scratch_space(const size_t num_elements)
 {
     // WASM needs to release slab so it can be reused elsewhere.
-    // But for native code it's more performant to hold onto it.
+    // But for native code it's more performant to hold onto it. Each thread holds its own, so that FFTs run by different
+    // threads (e.g. for concurrent requests to `bb serve`) do not share intermediates. It is not taken from the proof
+    // arena of the thread, as it outlives the proof.
 #ifdef __wasm__
     return std::static_pointer_cast<Fr[]>(get_mem_slab(num_elements * sizeof(Fr)));
 #else
-    static std::shared_ptr<Fr[]> working_memory = nullptr;
-    static size_t current_size = 0;
+    thread_local std::shared_ptr<Fr[]> working_memory = nullptr;
+    thread_local size_t current_size = 0;
     if (num_elements > current_size) {
-        working_memory = std::static_pointer_cast<Fr[]>(get_mem_slab(num_elements * sizeof(Fr)));
+        working_memory = nullptr;
+        working_memory = std::static_pointer_cast<Fr[]>(allocate_with_memory_policy(num_elements * sizeof(Fr)));
         current_size = num_elements;
     }
     return working_memory;
@@ -391,6 +398,260 @@ void fft_inner_parallel(
     }
 }
 
+namespace {
+
+constexpr size_t TRANSPOSE_TILE_SIZE = 16;
+
+/**
+ * Transpose the num_rows x num_cols matrix with rows src_row(0), src_row(1), ... into the matrix with rows
+ * dst_row(0), dst_row(1), ... The matrix is transposed a tile at a time, so that the rows read and written by a tile
+ * stay in cache.
+ */
+template <typename Fr, typename SrcRow, typename DstRow>
+void transpose(const SrcRow& src_row,
+               const DstRow& dst_row,
+               const size_t num_rows,
+               const size_t num_cols,
+               const size_t num_threads)
+{
+    const size_t tile_size = std::min({ TRANSPOSE_TILE_SIZE, num_rows, num_cols });
+    const size_t num_tile_rows = num_rows / tile_size;
+    parallel_for(num_threads, [&](size_t j) {
+        std::array<Fr*, TRANSPOSE_TILE_SIZE> dst_rows;
+        for (size_t tile_row = (j * num_tile_rows) / num_threads; tile_row < ((j + 1) * num_tile_rows) / num_threads;
+             ++tile_row) {
+            const size_t row_start = tile_row * tile_size;
+            for (size_t col_start = 0; col_start < num_cols; col_start += tile_size) {
+                for (size_t k = 0; k < tile_size; ++k) {
+                    dst_rows[k] = dst_row(col_start + k);
+                }
+                for (size_t row = row_start; row < row_start + tile_size; ++row) {
+                    const Fr* src = src_row(row) + col_start;
+                    for (size_t k = 0; k < tile_size; ++k) {
+                        Fr::__copy(src[k], dst_rows[k][row]);
+                    }
+                }
+            }
+        }
+    });
+}
+
+/**
+ * In-place fft of size 2^log2_size, with radix-4 butterflies (and one radix-2 round if log2_size is odd). The roots
+ * are read from an EvaluationDomain radix-4 root table of a domain of at least this size.
+ */
+template <typename Fr> void fft_radix_4_serial(Fr* coeffs, const size_t log2_size, const Fr* radix_4_roots)
+{
+    const size_t size = 1UL << log2_size;
+    for (size_t i = 0; i < size; ++i) {
+        const size_t swap_index = reverse_bits((uint32_t)i, (uint32_t)log2_size);
+        if (i < swap_index) {
+            Fr::__swap(coeffs[i], coeffs[swap_index]);
+        }
+    }
+
+    size_t m = 1;
+    if (log2_size & 1) {
+        for (size_t k = 0; k < size; k += 2) {
+            Fr temp = coeffs[k + 1];
+            coeffs[k + 1] = coeffs[k] - temp;
+            coeffs[k] += temp;
+        }
+        m = 2;
+    }
+
+    // Each butterfly does the work of two radix-2 rounds, combining four ffts of size m into one of size 4m:
+    // the pairs (x₀, x₁) and (x₂, x₃) with the root ω_{2m}^j, then the results with the roots ω_{4m}^j, ω_{4m}^{j + m}
+    for (; m < size; m <<= 2) {
+        const Fr* round_roots = radix_4_roots + 3 * (m - 1);
+        for (size_t k = 0; k < size; k += 4 * m) {
+            for (size_t j = 0; j < m; ++j) {
+                Fr* x = coeffs + k + j;
+                const Fr* roots = round_roots + 3 * j;
+                const Fr t1 = x[m] * roots[0];
+                const Fr t3 = x[3 * m] * roots[0];
+                const Fr u0 = x[0] + t1;
+                const Fr u1 = x[0] - t1;
+                const Fr u2 = (x[2 * m] + t3) * roots[1];
+                const Fr u3 = (x[2 * m] - t3) * roots[2];
+                x[0] = u0 + u2;
+                x[2 * m] = u0 - u2;
+                x[m] = u1 + u3;
+                x[3 * m] = u1 - u3;
+            }
+        }
+    }
+}
+
+} // namespace
+
+/**
+ * @brief Six-step fft of the polynomial split across `coeffs`, written to `target` (which may be `coeffs`)
+ *
+ * @details With n = n₁n₂, j = j₁ + n₁j₂ and k = k₂ + n₂k₁, the fft X_k = ∑ x_j ω^{jk} is
+ *
+ *      X_{k₂ + n₂k₁} = ∑_{j₁} ω_{n₁}^{j₁k₁} ω^{j₁k₂} ∑_{j₂} ω_{n₂}^{j₂k₂} x_{j₁ + n₁j₂}
+ *
+ * i.e. n₁ ffts of size n₂ over the columns of x viewed as an n₂ x n₁ matrix, a twiddle by ω^{j₁k₂}, and n₂ ffts of
+ * size n₁ over the rows of the result. The columns are made rows by transposes, so that every small fft runs in
+ * cache on contiguous memory: the whole fft makes four passes over memory, plus the three transposes, instead of
+ * log(n) passes.
+ *
+ * @param root_table the round roots of the domain, forward or inverse
+ * @param radix_4_root_table the matching radix-4 roots of the domain
+ */
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_inner_six_step(const std::vector<Fr*>& coeffs,
+                        const std::vector<Fr*>& target,
+                        const EvaluationDomain<Fr>& domain,
+                        const std::vector<Fr*>& root_table,
+                        const std::vector<Fr>& radix_4_root_table)
+{
+    const size_t num_polys = coeffs.size();
+    ASSERT(is_power_of_two(num_polys) && target.size() == num_polys);
+    const size_t poly_size = domain.size / num_polys;
+    const size_t poly_mask = poly_size - 1;
+    const size_t log2_poly_size = (size_t)numeric::get_msb(poly_size);
+
+    const size_t log2_n1 = domain.log2_size / 2;
+    const size_t log2_n2 = domain.log2_size - log2_n1;
+    const size_t n1 = 1UL << log2_n1;
+    const size_t n2 = 1UL << log2_n2;
+    // the rows of the matrices held in `coeffs` and `target` are of size n₁, and must not straddle two polynomials
+    ASSERT(log2_n1 >= 2 && n1 <= poly_size);
+    ASSERT(radix_4_root_table.size() >= 3 * (n2 / 2 - 1));
+
+    auto scratch_space_ptr = get_scratch_space<Fr>(domain.size);
+    Fr* scratch_space = scratch_space_ptr.get();
+
+    const auto scratch_row = [scratch_space, log2_n2](size_t i) { return scratch_space + (i << log2_n2); };
+    const auto poly_row = [log2_n1, log2_poly_size, poly_mask](const std::vector<Fr*>& polys) {
+        return [&polys, log2_n1, log2_poly_size, poly_mask](size_t i) {
+            const size_t index = i << log2_n1;
+            return &polys[index >> log2_poly_size][index & poly_mask];
+        };
+    };
+
+    // Step 1: transpose x, viewed as an n₂ x n₁ matrix, into the scratch space
+    transpose<Fr>(poly_row(coeffs), scratch_row, n2, n1, domain.num_threads);
+
+    // Steps 2 and 3: the n₁ ffts of size n₂, each followed by its twiddle ω^{j₁k₂}
+    parallel_for(domain.num_threads, [&](size_t j) {
+        for (size_t j1 = (j * n1) / domain.num_threads; j1 < ((j + 1) * n1) / domain.num_threads; ++j1) {
+            Fr* row = scratch_row(j1);
+            fft_radix_4_serial(row, log2_n2, &radix_4_root_table[0]);
+            // the last round table holds ω^j for j < n/2, and n₁ <= n/2
+            const Fr& twiddle_root = root_table.back()[j1];
+            Fr twiddle = twiddle_root;
+            for (size_t k2 = 1; k2 < n2; ++k2) {
+                row[k2] *= twiddle;
+                twiddle *= twiddle_root;
+            }
+        }
+    });
+
+    // Step 4: transpose back into the target, as an n₂ x n₁ matrix
+    transpose<Fr>(scratch_row, poly_row(target), n1, n2, domain.num_threads);
+
+    // Step 5: the n₂ ffts of size n₁
+    const auto target_row = poly_row(target);
+    parallel_for(domain.num_threads, [&](size_t j) {
+        for (size_t k2 = (j * n2) / domain.num_threads; k2 < ((j + 1) * n2) / domain.num_threads; ++k2) {
+            fft_radix_4_serial(target_row(k2), log2_n1, &radix_4_root_table[0]);
+        }
+    });
+
+    // Step 6: transpose the result, X_{k₂ + n₂k₁} at (k₂, k₁), into natural order
+    transpose<Fr>(target_row, scratch_row, n2, n1, domain.num_threads);
+    ITERATE_OVER_DOMAIN_START(domain);
+    Fr::__copy(scratch_space[i], target[i >> log2_poly_size][i & poly_mask]);
+    ITERATE_OVER_DOMAIN_END;
+}
+
+namespace {
+
+template <typename Fr> bool use_six_step_fft(const EvaluationDomain<Fr>& domain, const size_t num_polys)
+{
+    // the six-step fft needs the radix-4 roots, and rows of size n₁ = 2^⌊log(n)/2⌋ within each polynomial
+    return domain.fft_algorithm == FftAlgorithm::SIX_STEP && !domain.get_radix_4_roots().empty() &&
+           (num_polys << (domain.log2_size / 2)) <= domain.size;
+}
+
+/**
+ * In-place fft (or inverse fft, without the scaling by 1/n) of the polynomial split across `coeffs`, with the kernel
+ * selected by the domain.
+ */
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_inner(const std::vector<Fr*>& coeffs, const EvaluationDomain<Fr>& domain, const bool inverse)
+{
+    const auto& root_table = inverse ? domain.get_inverse_round_roots() : domain.get_round_roots();
+    if (use_six_step_fft(domain, coeffs.size())) {
+        const auto& radix_4_root_table = inverse ? domain.get_inverse_radix_4_roots() : domain.get_radix_4_roots();
+        fft_inner_six_step(coeffs, coeffs, domain, root_table, radix_4_root_table);
+    } else {
+        fft_inner_parallel(coeffs, domain, inverse ? domain.root_inverse : domain.root, root_table);
+    }
+}
+
+constexpr size_t FFT_MANY_TILE_SIZE = 4;
+
+/**
+ * In-place radix-2 fft of each of the polynomials in `coeffs`, all of the domain size. Each round is one pass over
+ * the domain in which every root is loaded once and applied to all of the polynomials.
+ */
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_inner_parallel_many(std::span<Fr*> coeffs,
+                             const EvaluationDomain<Fr>& domain,
+                             const std::vector<Fr*>& root_table)
+{
+    parallel_for(domain.num_threads, [&](size_t j) {
+        for (size_t i = (j * domain.thread_size); i < ((j + 1) * domain.thread_size); ++i) {
+            const size_t swap_index = reverse_bits((uint32_t)i, (uint32_t)domain.log2_size);
+            if (i < swap_index) {
+                for (Fr* poly : coeffs) {
+                    Fr::__swap(poly[i], poly[swap_index]);
+                }
+            }
+        }
+    });
+
+    for (size_t m = 1; m < domain.size; m <<= 1) {
+        parallel_for(domain.num_threads, [&](size_t j) {
+            // the same flattened loop over the butterflies of a round as fft_inner_parallel
+            const size_t start = j * (domain.thread_size >> 1);
+            const size_t end = (j + 1) * (domain.thread_size >> 1);
+            const size_t block_mask = m - 1;
+            const size_t index_mask = ~block_mask;
+            if (m == 1) {
+                for (size_t i = start; i < end; ++i) {
+                    for (Fr* poly : coeffs) {
+                        Fr temp = poly[2 * i + 1];
+                        poly[2 * i + 1] = poly[2 * i] - temp;
+                        poly[2 * i] += temp;
+                    }
+                }
+                return;
+            }
+            const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
+            for (size_t i = start; i < end; ++i) {
+                const size_t k1 = (i & index_mask) << 1;
+                const size_t j1 = i & block_mask;
+                const Fr root = round_roots[j1];
+                for (Fr* poly : coeffs) {
+                    Fr temp = root * poly[k1 + j1 + m];
+                    poly[k1 + j1 + m] = poly[k1 + j1] - temp;
+                    poly[k1 + j1] += temp;
+                }
+            }
+        });
+    }
+}
+
+} // namespace
+
 template <typename Fr>
     requires SupportsFFT<Fr>
 void partial_fft_serial_inner(Fr* coeffs,
@@ -524,28 +785,32 @@ template <typename Fr>
     requires SupportsFFT<Fr>
 void fft(Fr* coeffs, const EvaluationDomain<Fr>& domain)
 {
-    fft_inner_parallel({ coeffs }, domain, domain.root, domain.get_round_roots());
+    fft_inner({ coeffs }, domain, false);
 }
 
 template <typename Fr>
     requires SupportsFFT<Fr>
 void fft(Fr* coeffs, Fr* target, const EvaluationDomain<Fr>& domain)
 {
-    fft_inner_parallel(coeffs, target, domain, domain.root, domain.get_round_roots());
+    if (use_six_step_fft(domain, 1)) {
+        fft_inner_six_step({ coeffs }, { target }, domain, domain.get_round_roots(), domain.get_radix_4_roots());
+    } else {
+        fft_inner_parallel(coeffs, target, domain, domain.root, domain.get_round_roots());
+    }
 }
 
 template <typename Fr>
     requires SupportsFFT<Fr>
 void fft(std::vector<Fr*> coeffs, const EvaluationDomain<Fr>& domain)
 {
-    fft_inner_parallel<Fr>(coeffs, domain.size, domain.root, domain.get_round_roots());
+    fft_inner(coeffs, domain, false);
 }
 
 template <typename Fr>
     requires SupportsFFT<Fr>
 void ifft(Fr* coeffs, const EvaluationDomain<Fr>& domain)
 {
-    fft_inner_parallel({ coeffs }, domain, domain.root_inverse, domain.get_inverse_round_roots());
+    fft_inner({ coeffs }, domain, true);
     ITERATE_OVER_DOMAIN_START(domain);
     coeffs[i] *= domain.domain_inverse;
     ITERATE_OVER_DOMAIN_END;
@@ -555,7 +820,12 @@ template <typename Fr>
     requires SupportsFFT<Fr>
 void ifft(Fr* coeffs, Fr* target, const EvaluationDomain<Fr>& domain)
 {
-    fft_inner_parallel(coeffs, target, domain, domain.root_inverse, domain.get_inverse_round_roots());
+    if (use_six_step_fft(domain, 1)) {
+        fft_inner_six_step(
+            { coeffs }, { target }, domain, domain.get_inverse_round_roots(), domain.get_inverse_radix_4_roots());
+    } else {
+        fft_inner_parallel(coeffs, target, domain, domain.root_inverse, domain.get_inverse_round_roots());
+    }
     ITERATE_OVER_DOMAIN_START(domain);
     target[i] *= domain.domain_inverse;
     ITERATE_OVER_DOMAIN_END;
@@ -565,7 +835,7 @@ template <typename Fr>
     requires SupportsFFT<Fr>
 void ifft(std::vector<Fr*> coeffs, const EvaluationDomain<Fr>& domain)
 {
-    fft_inner_parallel(coeffs, domain, domain.root_inverse, domain.get_inverse_round_roots());
+    fft_inner(coeffs, domain, true);
 
     const size_t num_polys = coeffs.size();
     ASSERT(is_power_of_two(num_polys));
@@ -583,7 +853,7 @@ template <typename Fr>
     requires SupportsFFT<Fr>
 void fft_with_constant(Fr* coeffs, const EvaluationDomain<Fr>& domain, const Fr& value)
 {
-    fft_inner_parallel({ coeffs }, domain, domain.root, domain.get_round_roots());
+    fft_inner({ coeffs }, domain, false);
     ITERATE_OVER_DOMAIN_START(domain);
     coeffs[i] *= value;
     ITERATE_OVER_DOMAIN_END;
@@ -683,6 +953,43 @@ void coset_fft(Fr* coeffs,
     }
 }
 
+/**
+ * @brief In-place coset fft of several polynomials over the same domain
+ *
+ * @details The coset scaling of all of the polynomials is one pass over the domain, computing each power of the
+ * generator once. With the radix-2 kernel, the polynomials are then transformed a tile at a time, each round of
+ * butterflies of a tile being one parallel pass that loads each root once for the whole tile. With the six-step
+ * kernel, whose rounds run in cache already, each polynomial is transformed in turn.
+ */
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void coset_fft_many(std::span<Fr*> coeffs, const EvaluationDomain<Fr>& domain)
+{
+    const size_t generator_size = domain.generator_size;
+    parallel_for(domain.num_threads, [&](size_t j) {
+        const size_t offset = j * (generator_size / domain.num_threads);
+        const size_t end = offset + (generator_size / domain.num_threads);
+        Fr work_generator = domain.generator.pow(static_cast<uint64_t>(offset));
+        for (size_t i = offset; i < end; ++i) {
+            for (Fr* poly : coeffs) {
+                poly[i] *= work_generator;
+            }
+            work_generator *= domain.generator;
+        }
+    });
+
+    if (use_six_step_fft(domain, 1)) {
+        for (Fr* poly : coeffs) {
+            fft_inner_six_step({ poly }, { poly }, domain, domain.get_round_roots(), domain.get_radix_4_roots());
+        }
+        return;
+    }
+    for (size_t i = 0; i < coeffs.size(); i += FFT_MANY_TILE_SIZE) {
+        fft_inner_parallel_many(
+            coeffs.subspan(i, std::min(FFT_MANY_TILE_SIZE, coeffs.size() - i)), domain, domain.get_round_roots());
+    }
+}
+
 template <typename Fr>
     requires SupportsFFT<Fr>
 void coset_fft_with_constant(Fr* coeffs, const EvaluationDomain<Fr>& domain, const Fr& constant)
@@ -704,7 +1011,7 @@ template <typename Fr>
     requires SupportsFFT<Fr>
 void ifft_with_constant(Fr* coeffs, const EvaluationDomain<Fr>& domain, const Fr& value)
 {
-    fft_inner_parallel({ coeffs }, domain, domain.root_inverse, domain.get_inverse_round_roots());
+    fft_inner({ coeffs }, domain, true);
     Fr T0 = domain.domain_inverse * value;
     ITERATE_OVER_DOMAIN_START(domain);
     coeffs[i] *= T0;
@@ -756,9 +1063,12 @@ void sub(const Fr* a_coeffs, const Fr* b_coeffs, Fr* r_coeffs, const EvaluationD
 template <typename Fr>
 void mul(const Fr* a_coeffs, const Fr* b_coeffs, Fr* r_coeffs, const EvaluationDomain<Fr>& domain)
 {
-    ITERATE_OVER_DOMAIN_START(domain);
-    r_coeffs[i] = a_coeffs[i] * b_coeffs[i];
-    ITERATE_OVER_DOMAIN_END;
+    parallel_for(domain.num_threads, [&](size_t j) {
+        const size_t offset = j * domain.thread_size;
+        field_vector::mul<Fr>({ a_coeffs + offset, domain.thread_size },
+                              { b_coeffs + offset, domain.thread_size },
+                              { r_coeffs + offset, domain.thread_size });
+    });
 }
 
 template <typename Fr> Fr evaluate(const Fr* coeffs, const Fr& z, const size_t n)
@@ -872,7 +1182,7 @@ void compute_lagrange_polynomial_fft(Fr* l_1_coefficients,
     });
 
     // Compute 1/(X_i - 1) using Montgomery batch inversion
-    Fr::batch_invert(l_1_coefficients, target_domain.size);
+    Fr::parallel_batch_invert(std::span{ l_1_coefficients, target_domain.size });
 
     // Step 2: Compute numerator (1/n)*(X_i^n - 1)
     // First compute X_i^n (which forms a multiplicative subgroup of order k)
@@ -1146,7 +1456,7 @@ Fr compute_barycentric_evaluation(const Fr* coeffs,
         work_root *= domain.root_inverse;
     }
 
-    Fr::batch_invert(denominators, num_coeffs);
+    Fr::parallel_batch_invert(std::span{ denominators, num_coeffs });
 
     Fr result = Fr::zero();
 
@@ -1371,6 +1681,11 @@ template fr evaluate<fr>(const std::vector<fr*>, const fr&, const size_t);
 template void copy_polynomial<fr>(const fr*, fr*, size_t, size_t);
 template void fft_inner_serial<fr>(std::vector<fr*>, const size_t, const std::vector<fr*>&);
 template void fft_inner_parallel<fr>(std::vector<fr*>, const EvaluationDomain<fr>&, const fr&, const std::vector<fr*>&);
+template void fft_inner_six_step<fr>(const std::vector<fr*>&,
+                                     const std::vector<fr*>&,
+                                     const EvaluationDomain<fr>&,
+                                     const std::vector<fr*>&,
+                                     const std::vector<fr>&);
 template void fft<fr>(fr*, const EvaluationDomain<fr>&);
 template void fft<fr>(fr*, fr*, const EvaluationDomain<fr>&);
 template void fft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
@@ -1379,6 +1694,7 @@ template void coset_fft<fr>(fr*, const EvaluationDomain<fr>&);
 template void coset_fft<fr>(fr*, fr*, const EvaluationDomain<fr>&);
 template void coset_fft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
 template void coset_fft<fr>(fr*, const EvaluationDomain<fr>&, const EvaluationDomain<fr>&, const size_t);
+template void coset_fft_many<fr>(std::span<fr*>, const EvaluationDomain<fr>&);
 template void coset_fft_with_constant<fr>(fr*, const EvaluationDomain<fr>&, const fr&);
 template void coset_fft_with_generator_shift<fr>(fr*, const EvaluationDomain<fr>&, const fr&);
 template void ifft<fr>(fr*, const EvaluationDomain<fr>&);
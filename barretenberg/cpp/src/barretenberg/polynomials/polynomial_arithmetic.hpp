@@ -1,5 +1,6 @@
 #pragma once
 #include "evaluation_domain.hpp"
+#include <span>
 
 namespace barretenberg {
 namespace polynomial_arithmetic {
@@ -38,6 +39,13 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
                         const EvaluationDomain<Fr>& domain,
                         const Fr&,
                         const std::vector<Fr*>& root_table);
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_inner_six_step(const std::vector<Fr*>& coeffs,
+                        const std::vector<Fr*>& target,
+                        const EvaluationDomain<Fr>& domain,
+                        const std::vector<Fr*>& root_table,
+                        const std::vector<Fr>& radix_4_root_table);
 
 template <typename Fr>
     requires SupportsFFT<Fr>
@@ -68,6 +76,10 @@ void coset_fft(Fr* coeffs,
                const EvaluationDomain<Fr>& large_domain,
                const size_t domain_extension);
 
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void coset_fft_many(std::span<Fr*> coeffs, const EvaluationDomain<Fr>& domain);
+
 template <typename Fr>
     requires SupportsFFT<Fr>
 void coset_fft_with_constant(Fr* coeffs, const EvaluationDomain<Fr>& domain, const Fr& constant);
@@ -384,6 +396,11 @@ extern template void fft_inner_parallel<fr>(std::vector<fr*>,
                                             const EvaluationDomain<fr>&,
                                             const fr&,
                                             const std::vector<fr*>&);
+extern template void fft_inner_six_step<fr>(const std::vector<fr*>&,
+                                            const std::vector<fr*>&,
+                                            const EvaluationDomain<fr>&,
+                                            const std::vector<fr*>&,
+                                            const std::vector<fr>&);
 extern template void fft<fr>(fr*, const EvaluationDomain<fr>&);
 extern template void fft<fr>(fr*, fr*, const EvaluationDomain<fr>&);
 extern template void fft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
@@ -392,6 +409,7 @@ extern template void coset_fft<fr>(fr*, const EvaluationDomain<fr>&);
 extern template void coset_fft<fr>(fr*, fr*, const EvaluationDomain<fr>&);
 extern template void coset_fft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
 extern template void coset_fft<fr>(fr*, const EvaluationDomain<fr>&, const EvaluationDomain<fr>&, const size_t);
+extern template void coset_fft_many<fr>(std::span<fr*>, const EvaluationDomain<fr>&);
 extern template void coset_fft_with_constant<fr>(fr*, const EvaluationDomain<fr>&, const fr&);
 extern template void coset_fft_with_generator_shift<fr>(fr*, const EvaluationDomain<fr>&, const fr&);
 extern template void ifft<fr>(fr*, const EvaluationDomain<fr>&);
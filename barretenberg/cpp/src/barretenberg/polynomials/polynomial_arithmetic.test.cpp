@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <gtest/gtest.h>
+#include <thread>
 #include <utility>
 
 using namespace barretenberg;
@@ -114,6 +115,32 @@ TEST(polynomials, split_polynomial_evaluate)
               polynomial_arithmetic::evaluate(poly, z, n));
 }
 
+TEST(polynomials, evaluation_domains_share_lookup_tables)
+{
+    constexpr size_t n = 1 << 10;
+    auto domain = evaluation_domain(n);
+    domain.compute_lookup_table();
+    auto other_domain = evaluation_domain(n);
+    other_domain.compute_lookup_table();
+    auto copied_domain = domain;
+    auto larger_domain = evaluation_domain(2 * n);
+    larger_domain.compute_lookup_table();
+
+    EXPECT_EQ(other_domain.get_round_roots(), domain.get_round_roots());
+    EXPECT_EQ(copied_domain.get_inverse_round_roots(), domain.get_inverse_round_roots());
+    EXPECT_NE(larger_domain.get_round_roots()[0], domain.get_round_roots()[0]);
+
+    // the round roots are the powers of the round's root of unity
+    const auto& round_roots = domain.get_round_roots();
+    for (size_t i = 0; i < round_roots.size(); ++i) {
+        const size_t m = 1UL << (i + 1);
+        const fr round_root = domain.root.pow(static_cast<uint64_t>(n / (2 * m)));
+        for (size_t j = 0; j < m; ++j) {
+            EXPECT_EQ(round_roots[i][j], round_root.pow(static_cast<uint64_t>(j)));
+        }
+    }
+}
+
 TEST(polynomials, basic_fft)
 {
     constexpr size_t n = 1 << 14;
@@ -186,6 +213,131 @@ TEST(polynomials, split_polynomial_fft_ifft_consistency)
     }
 }
 
+TEST(polynomials, six_step_fft_matches_radix_2_fft)
+{
+    // both parities of log(n), so that the ffts of size n₁ and n₂ differ
+    for (size_t log2_n = 4; log2_n <= 13; ++log2_n) {
+        const size_t n = 1UL << log2_n;
+        auto domain = evaluation_domain(n);
+        domain.compute_lookup_table();
+
+        std::vector<fr> radix_2(n);
+        for (auto& coeff : radix_2) {
+            coeff = fr::random_element();
+        }
+        std::vector<fr> six_step = radix_2;
+        std::vector<fr> out_of_place(n);
+
+        domain.fft_algorithm = FftAlgorithm::RADIX_2;
+        polynomial_arithmetic::fft(&radix_2[0], domain);
+        domain.fft_algorithm = FftAlgorithm::SIX_STEP;
+        polynomial_arithmetic::fft(&six_step[0], &out_of_place[0], domain);
+        polynomial_arithmetic::fft(&six_step[0], domain);
+        EXPECT_EQ(six_step, radix_2);
+        EXPECT_EQ(out_of_place, radix_2);
+
+        domain.fft_algorithm = FftAlgorithm::RADIX_2;
+        polynomial_arithmetic::coset_ifft(&radix_2[0], domain);
+        domain.fft_algorithm = FftAlgorithm::SIX_STEP;
+        polynomial_arithmetic::coset_ifft(&six_step[0], domain);
+        EXPECT_EQ(six_step, radix_2);
+    }
+}
+
+// Each thread has its own scratch space, so ffts run concurrently (e.g. for two requests to `bb serve`) do not overwrite
+// each other's intermediates.
+TEST(polynomials, six_step_fft_concurrent_threads)
+{
+    constexpr size_t n = 1 << 12;
+    constexpr size_t num_threads = 4;
+    auto domain = evaluation_domain(n);
+    domain.compute_lookup_table();
+
+    std::vector<std::vector<fr>> expected(num_threads, std::vector<fr>(n));
+    for (auto& poly : expected) {
+        for (auto& coeff : poly) {
+            coeff = fr::random_element();
+        }
+    }
+    auto results = expected;
+    domain.fft_algorithm = FftAlgorithm::RADIX_2;
+    for (auto& poly : expected) {
+        polynomial_arithmetic::coset_fft(&poly[0], domain);
+    }
+
+    domain.fft_algorithm = FftAlgorithm::SIX_STEP;
+    std::vector<std::thread> threads;
+    for (auto& poly : results) {
+        threads.emplace_back([&]() {
+            for (size_t i = 0; i < 8; ++i) {
+                polynomial_arithmetic::coset_fft(&poly[0], domain);
+                polynomial_arithmetic::coset_ifft(&poly[0], domain);
+            }
+            polynomial_arithmetic::coset_fft(&poly[0], domain);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(results, expected);
+}
+
+TEST(polynomials, split_polynomial_six_step_fft_matches_radix_2_fft)
+{
+    constexpr size_t n = 1 << 11;
+    constexpr size_t num_poly = 4;
+    auto domain = evaluation_domain(num_poly * n);
+    domain.compute_lookup_table();
+
+    std::vector<fr> radix_2(num_poly * n);
+    for (auto& coeff : radix_2) {
+        coeff = fr::random_element();
+    }
+    std::vector<fr> six_step = radix_2;
+    std::vector<fr*> six_step_polys;
+    for (size_t j = 0; j < num_poly; j++) {
+        six_step_polys.push_back(&six_step[j * n]);
+    }
+
+    domain.fft_algorithm = FftAlgorithm::RADIX_2;
+    polynomial_arithmetic::coset_fft(&radix_2[0], domain);
+    domain.fft_algorithm = FftAlgorithm::SIX_STEP;
+    polynomial_arithmetic::coset_fft(six_step_polys, domain);
+    EXPECT_EQ(six_step, radix_2);
+
+    polynomial_arithmetic::coset_ifft(six_step_polys, domain);
+    polynomial_arithmetic::coset_fft(six_step_polys, domain);
+    EXPECT_EQ(six_step, radix_2);
+}
+
+TEST(polynomials, coset_fft_many_matches_coset_fft)
+{
+    constexpr size_t n = 1 << 10;
+    // more than a tile of polynomials, and not a multiple of it
+    constexpr size_t num_polys = 6;
+    auto domain = evaluation_domain(n);
+    domain.compute_lookup_table();
+
+    for (const auto fft_algorithm : { FftAlgorithm::RADIX_2, FftAlgorithm::SIX_STEP }) {
+        domain.fft_algorithm = fft_algorithm;
+        std::vector<std::vector<fr>> expected(num_polys, std::vector<fr>(n));
+        std::vector<fr*> polys;
+        for (auto& poly : expected) {
+            for (auto& coeff : poly) {
+                coeff = fr::random_element();
+            }
+        }
+        auto result = expected;
+        for (size_t i = 0; i < num_polys; ++i) {
+            polynomial_arithmetic::coset_fft(&expected[i][0], domain);
+            polys.push_back(&result[i][0]);
+        }
+        polynomial_arithmetic::coset_fft_many<fr>(polys, domain);
+
+        EXPECT_EQ(result, expected);
+    }
+}
+
 TEST(polynomials, fft_coset_ifft_consistency)
 {
     constexpr size_t n = 256;
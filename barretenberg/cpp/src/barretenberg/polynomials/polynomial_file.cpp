@@ -0,0 +1,149 @@
+#include "polynomial_file.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/mem.hpp"
+#include "barretenberg/common/serialize.hpp"
+#include "barretenberg/common/slab_allocator.hpp"
+#include <fstream>
+
+#if !defined(__wasm__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+namespace barretenberg {
+
+namespace {
+const std::string MAGIC = "barretenberg polynomial file";
+
+std::shared_ptr<void> map_file(const std::string& path, size_t& file_size)
+{
+#if !defined(__wasm__)
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw_or_abort("Failed to open: " + path);
+    }
+    struct stat st {};
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        throw_or_abort("Failed to stat: " + path);
+    }
+    file_size = static_cast<size_t>(st.st_size);
+    // Private and writable: the pages are shared with the page cache until a polynomial is written to.
+    void* ptr = mmap(nullptr, file_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (ptr == MAP_FAILED) {
+        throw_or_abort("Failed to map: " + path);
+    }
+    return { ptr, [file_size](void* p) { munmap(p, file_size); } };
+#else
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        throw_or_abort("Failed to open: " + path);
+    }
+    file_size = static_cast<size_t>(file.tellg());
+    auto memory = get_mem_slab(file_size);
+    file.seekg(0);
+    file.read(static_cast<char*>(memory.get()), static_cast<std::streamsize>(file_size));
+    if (!file) {
+        throw_or_abort("Failed to read: " + path);
+    }
+    return memory;
+#endif
+}
+} // namespace
+
+std::vector<uint8_t> PolynomialFile::serialize_header(const std::vector<Entry>& entries_to_write) const
+{
+    using serialize::write;
+    std::vector<uint8_t> header;
+    write(header, MAGIC);
+    write(header, VERSION);
+    write(header, metadata);
+    write(header, static_cast<uint32_t>(entries_to_write.size()));
+    for (const auto& entry : entries_to_write) {
+        write(header, entry.name);
+        write(header, entry.element_size);
+        write(header, entry.size);
+        write(header, entry.offset);
+    }
+    return header;
+}
+
+void PolynomialFile::write(const std::string& path) const
+{
+    // The size of the header does not depend on the offsets, so it is laid out once to find where the data starts.
+    std::vector<Entry> entries_to_write = entries;
+    size_t offset = serialize_header(entries_to_write).size();
+    for (auto& entry : entries_to_write) {
+        offset = pad(offset, PAGE_SIZE);
+        entry.offset = offset;
+        offset += (entry.size + 1) * entry.element_size;
+    }
+    const std::vector<uint8_t> header = serialize_header(entries_to_write);
+
+    std::ofstream os(path, std::ios::binary | std::ios::trunc);
+    os.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+    const std::vector<char> zeroes(PAGE_SIZE, 0);
+    size_t position = header.size();
+    for (const auto& entry : entries_to_write) {
+        os.write(zeroes.data(), static_cast<std::streamsize>(entry.offset - position));
+        const auto data_size = static_cast<std::streamsize>(entry.size * entry.element_size);
+        os.write(reinterpret_cast<const char*>(entry.data), data_size);
+        os.write(zeroes.data(), static_cast<std::streamsize>(entry.element_size));
+        position = entry.offset + (entry.size + 1) * entry.element_size;
+    }
+    if (!os.good()) {
+        throw_or_abort(format("Failed to write: ", path));
+    }
+}
+
+PolynomialFile PolynomialFile::map(const std::string& path)
+{
+    using serialize::read;
+    PolynomialFile file;
+    size_t file_size = 0;
+    file.mapping = map_file(path, file_size);
+
+    const auto* it = static_cast<const uint8_t*>(file.mapping.get());
+    std::string magic;
+    read(it, magic);
+    if (magic != MAGIC) {
+        throw_or_abort("Not a polynomial file: " + path);
+    }
+    uint32_t version = 0;
+    read(it, version);
+    if (version != VERSION) {
+        throw_or_abort(format("Unsupported polynomial file version ", version, ": ", path));
+    }
+    read(it, file.metadata);
+    uint32_t num_entries = 0;
+    read(it, num_entries);
+    file.entries.resize(num_entries);
+    for (auto& entry : file.entries) {
+        read(it, entry.name);
+        read(it, entry.element_size);
+        read(it, entry.size);
+        read(it, entry.offset);
+        entry.data = nullptr;
+        if (entry.offset % PAGE_SIZE != 0 || entry.offset + (entry.size + 1) * entry.element_size > file_size) {
+            throw_or_abort("Polynomial " + entry.name + " is out of the bounds of " + path);
+        }
+    }
+    return file;
+}
+
+const PolynomialFile::Entry& PolynomialFile::find(const std::string& name) const
+{
+    for (const auto& entry : entries) {
+        if (entry.name == name) {
+            return entry;
+        }
+    }
+    throw_or_abort("Polynomial " + name + " is not in the file");
+}
+
+} // namespace barretenberg
+// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic)
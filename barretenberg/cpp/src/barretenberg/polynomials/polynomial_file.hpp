@@ -0,0 +1,88 @@
+#pragma once
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "polynomial.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace barretenberg {
+
+/**
+ * @brief A single file of named polynomials and a block of metadata, laid out so that the polynomials can be mapped
+ * and used in place, e.g. the precomputed polynomials of a proving key.
+ *
+ * @details The file is a header, serialized like the rest of barretenberg:
+ *   magic string, version (u32), metadata (byte vector), number of polynomials (u32), and for each polynomial its name
+ *   (string), element size (u32), size (u64) and offset in the file (u64),
+ * followed by the coefficients of each polynomial in memory (Montgomery) form, at page aligned offsets. Each
+ * polynomial is followed by a zero coefficient, the one Polynomial keeps past its size.
+ *
+ * Reading maps the file privately, so that the polynomials returned by `get` share their pages with the page cache, and
+ * with every other process mapping the file, until they are written to. In WASM, which has no mmap, the file is read
+ * into memory instead.
+ */
+class PolynomialFile {
+  public:
+    static constexpr uint32_t VERSION = 1;
+    static constexpr size_t PAGE_SIZE = 4096;
+
+    /**
+     * @brief Add a polynomial to be written. It is not copied, so must outlive the call to write.
+     */
+    template <typename Fr> void add(const std::string& name, const Polynomial<Fr>& polynomial)
+    {
+        entries.push_back({ .name = name,
+                            .element_size = sizeof(Fr),
+                            .size = polynomial.size(),
+                            .offset = 0,
+                            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+                            .data = reinterpret_cast<const uint8_t*>(polynomial.data().get()) });
+    }
+
+    void set_metadata(std::vector<uint8_t> metadata_) { metadata = std::move(metadata_); }
+
+    void write(const std::string& path) const;
+
+    /**
+     * @brief Map a file written by `write`
+     */
+    static PolynomialFile map(const std::string& path);
+
+    const std::vector<uint8_t>& get_metadata() const { return metadata; }
+
+    size_t get_num_polynomials() const { return entries.size(); }
+
+    /**
+     * @brief The named polynomial of a mapped file, backed by the mapping
+     */
+    template <typename Fr> Polynomial<Fr> get(const std::string& name) const
+    {
+        const Entry& entry = find(name);
+        if (entry.element_size != sizeof(Fr)) {
+            throw_or_abort("Polynomial " + name + " has elements of " + std::to_string(entry.element_size) + " bytes");
+        }
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        auto* coefficients = reinterpret_cast<Fr*>(static_cast<uint8_t*>(mapping.get()) + entry.offset);
+        return Polynomial<Fr>(std::shared_ptr<Fr[]>(mapping, coefficients), entry.size);
+    }
+
+  private:
+    struct Entry {
+        std::string name;
+        uint32_t element_size;
+        uint64_t size;
+        uint64_t offset;
+        // The coefficients to write
+        const uint8_t* data;
+    };
+
+    const Entry& find(const std::string& name) const;
+
+    std::vector<uint8_t> serialize_header(const std::vector<Entry>& entries_to_write) const;
+
+    std::vector<Entry> entries;
+    std::vector<uint8_t> metadata;
+    std::shared_ptr<void> mapping;
+};
+
+} // namespace barretenberg
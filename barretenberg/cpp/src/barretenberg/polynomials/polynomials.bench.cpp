@@ -1,15 +1,19 @@
 #include "barretenberg/common/mem.hpp"
+#include "barretenberg/common/slab_allocator.hpp"
 #include "barretenberg/ecc/curves/bn254/fq.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/ecc/curves/bn254/g1.hpp"
 #include "barretenberg/ecc/curves/bn254/g2.hpp"
 #include "barretenberg/ecc/curves/bn254/pairing.hpp"
 #include "barretenberg/ecc/groups/wnaf.hpp"
+#include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 #include "barretenberg/srs/io.hpp"
 #include <benchmark/benchmark.h>
+#include <map>
+#include <memory>
 
 using namespace benchmark;
 using namespace barretenberg;
@@ -251,6 +255,77 @@ void fft_bench_serial(State& state) noexcept
 }
 BENCHMARK(fft_bench_serial)->RangeMultiplier(2)->Range(START * 4, MAX_GATES * 4)->Unit(benchmark::kMicrosecond);
 
+/**
+ * The memory policy of the benchmarks below: 0 for 4K pages, 1 for transparent and 2 for explicit huge pages, and the
+ * same plus 3 with the pages interleaved across NUMA nodes. Their buffers are allocated outside of the timed loop.
+ */
+MemoryPolicy get_bench_memory_policy(const int64_t arg)
+{
+    return { .huge_pages = static_cast<HugePages>(arg % 3),
+             .huge_page_threshold = HUGE_PAGE_SIZE,
+             .numa_interleave = arg >= 3 };
+}
+
+void pippenger_memory_policy_bench(State& state) noexcept
+{
+    set_memory_policy(get_bench_memory_policy(state.range(0)));
+    auto points = scalar_multiplication::point_table_alloc<g1::affine_element>(MAX_GATES);
+    memcpy((void*)points.get(), (void*)globals.monomials, sizeof(g1::affine_element) * MAX_GATES * 2);
+    auto scalars = std::static_pointer_cast<fr[]>(get_mem_slab(sizeof(fr) * MAX_GATES));
+    memcpy((void*)scalars.get(), (void*)globals.scalars, sizeof(fr) * MAX_GATES);
+    scalar_multiplication::pippenger_runtime_state<curve::BN254> run_state(MAX_GATES);
+    for (auto _ : state) {
+        DoNotOptimize(
+            scalar_multiplication::pippenger<curve::BN254>(scalars.get(), points.get(), MAX_GATES, run_state));
+    }
+    set_memory_policy(MemoryPolicy{});
+}
+BENCHMARK(pippenger_memory_policy_bench)->DenseRange(0, 5)->Unit(benchmark::kMillisecond);
+
+void coset_fft_memory_policy_bench(State& state) noexcept
+{
+    set_memory_policy(get_bench_memory_policy(state.range(0)));
+    auto coefficients = std::static_pointer_cast<fr[]>(get_mem_slab(sizeof(fr) * MAX_GATES * 4));
+    memcpy((void*)coefficients.get(), (void*)globals.data, sizeof(fr) * MAX_GATES * 4);
+    for (auto _ : state) {
+        barretenberg::polynomial_arithmetic::coset_fft(coefficients.get(), evaluation_domains[9]);
+    }
+    set_memory_policy(MemoryPolicy{});
+}
+BENCHMARK(coset_fft_memory_policy_bench)->DenseRange(0, 5)->Unit(benchmark::kMicrosecond);
+
+/**
+ * Domains of 2^16 to 2^24 for the comparison of the fft kernels, created on first use: the root tables of the larger
+ * domains are too big to build for every run of this binary.
+ */
+evaluation_domain& get_fft_kernel_bench_domain(const size_t size)
+{
+    static std::map<size_t, std::unique_ptr<evaluation_domain>> domains;
+    auto& domain = domains[size];
+    if (!domain) {
+        domain = std::make_unique<evaluation_domain>(size);
+        domain->compute_lookup_table();
+    }
+    return *domain;
+}
+
+void fft_kernel_bench(State& state, const FftAlgorithm fft_algorithm) noexcept
+{
+    auto& domain = get_fft_kernel_bench_domain(static_cast<size_t>(state.range(0)));
+    domain.fft_algorithm = fft_algorithm;
+    for (auto _ : state) {
+        barretenberg::polynomial_arithmetic::fft(globals.data, domain);
+    }
+}
+BENCHMARK_CAPTURE(fft_kernel_bench, radix_2, FftAlgorithm::RADIX_2)
+    ->RangeMultiplier(2)
+    ->Range(1 << 16, 1 << 24)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(fft_kernel_bench, six_step, FftAlgorithm::SIX_STEP)
+    ->RangeMultiplier(2)
+    ->Range(1 << 16, 1 << 24)
+    ->Unit(benchmark::kMillisecond);
+
 void pairing_bench(State& state) noexcept
 {
     uint64_t count = 0;
@@ -78,6 +78,16 @@ template <class Fr, size_t _length> class Univariate {
         return output;
     };
 
+    bool is_zero() const
+    {
+        for (size_t i = 0; i < _length; ++i) {
+            if (!evaluations[i].is_zero()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     // Operations between Univariate and other Univariate
     bool operator==(const Univariate& other) const = default;
 
@@ -1,6 +1,7 @@
 #pragma once
 #include "barretenberg/common/serialize.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/serialize/msgpack.hpp"
 #include <cstdint>
 
 // TODO(#557): The field-specific aliases for gates should be removed and the type could be explicit when this
@@ -58,6 +59,8 @@ template <typename FF> struct poly_triple_ {
     FF q_o;
     FF q_c;
 
+    // for serialization, update with any new fields
+    MSGPACK_FIELDS(a, b, c, q_m, q_l, q_r, q_o, q_c);
     friend bool operator==(poly_triple_<FF> const& lhs, poly_triple_<FF> const& rhs) = default;
 };
 using poly_triple = poly_triple_<barretenberg::fr>;
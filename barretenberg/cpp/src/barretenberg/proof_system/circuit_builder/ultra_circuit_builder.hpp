@@ -376,7 +376,7 @@ template <typename FF> class UltraCircuitBuilder_ : public CircuitBuilderBase<ar
          * @param builder
          * @return CircuitDataBackup
          */
-        template <typename CircuitBuilder> void restore_prefinilized_state(CircuitBuilder* builder)
+        template <typename CircuitBuilder> void restore_prefinilized_state(CircuitBuilder* builder) const
         {
             builder->public_inputs = public_inputs;
             builder->variables = variables;
@@ -416,6 +416,32 @@ template <typename FF> class UltraCircuitBuilder_ : public CircuitBuilderBase<ar
             builder->q_aux.resize(num_gates);
             builder->q_lookup_type.resize(num_gates);
         }
+        /**
+         * @brief Restores circuit constructor to a state stored with store_full_state, including its gates. The stored
+         * builder must not have used lookup tables, as those are not stored.
+         *
+         * @param builder
+         */
+        template <typename CircuitBuilder> void restore_full_state(CircuitBuilder& builder) const
+        {
+            builder.w_l = w_l;
+            builder.w_r = w_r;
+            builder.w_o = w_o;
+            builder.w_4 = w_4;
+            builder.q_m = q_m;
+            builder.q_c = q_c;
+            builder.q_1 = q_1;
+            builder.q_2 = q_2;
+            builder.q_3 = q_3;
+            builder.q_4 = q_4;
+            builder.q_arith = q_arith;
+            builder.q_sort = q_sort;
+            builder.q_elliptic = q_elliptic;
+            builder.q_aux = q_aux;
+            builder.q_lookup_type = q_lookup_type;
+            restore_prefinilized_state(&builder);
+        }
+
         /**
          * @brief Checks that the circuit state is the same as the stored circuit's one
          *
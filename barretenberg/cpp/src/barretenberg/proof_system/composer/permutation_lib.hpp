@@ -14,6 +14,7 @@
 #include "barretenberg/proof_system/flavor/flavor.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <initializer_list>
@@ -424,6 +425,9 @@ void compute_plonk_permutation_lagrange_polynomials_from_mapping(
 template <size_t program_width>
 void compute_monomial_and_coset_fft_polynomials_from_lagrange(std::string label, plonk::proving_key* key)
 {
+    std::array<barretenberg::polynomial, program_width> sigma_polynomials;
+    std::array<barretenberg::polynomial, program_width> sigma_ffts;
+    std::array<barretenberg::fr*, program_width> sigma_fft_coeffs;
     for (size_t i = 0; i < program_width; ++i) {
         std::string index = std::to_string(i + 1);
         std::string prefix = label + "_" + index;
@@ -431,16 +435,21 @@ void compute_monomial_and_coset_fft_polynomials_from_lagrange(std::string label,
         // Construct permutation polynomials in lagrange base
         auto sigma_polynomial_lagrange = key->polynomial_store.get(prefix + "_lagrange");
         // Compute permutation polynomial monomial form
-        barretenberg::polynomial sigma_polynomial(key->circuit_size);
+        sigma_polynomials[i] = barretenberg::polynomial(key->circuit_size);
         barretenberg::polynomial_arithmetic::ifft(
-            (barretenberg::fr*)&sigma_polynomial_lagrange[0], &sigma_polynomial[0], key->small_domain);
+            (barretenberg::fr*)&sigma_polynomial_lagrange[0], &sigma_polynomials[i][0], key->small_domain);
 
-        // Compute permutation polynomial coset FFT form
-        barretenberg::polynomial sigma_fft(sigma_polynomial, key->large_domain.size);
-        sigma_fft.coset_fft(key->large_domain);
+        sigma_ffts[i] = barretenberg::polynomial(sigma_polynomials[i], key->large_domain.size);
+        sigma_fft_coeffs[i] = &sigma_ffts[i][0];
+    }
+
+    // Compute permutation polynomial coset FFT forms, all together
+    barretenberg::polynomial_arithmetic::coset_fft_many<barretenberg::fr>(sigma_fft_coeffs, key->large_domain);
 
-        key->polynomial_store.put(prefix, std::move(sigma_polynomial));
-        key->polynomial_store.put(prefix + "_fft", std::move(sigma_fft));
+    for (size_t i = 0; i < program_width; ++i) {
+        std::string prefix = label + "_" + std::to_string(i + 1);
+        key->polynomial_store.put(prefix, std::move(sigma_polynomials[i]));
+        key->polynomial_store.put(prefix + "_fft", std::move(sigma_ffts[i]));
     }
 }
 
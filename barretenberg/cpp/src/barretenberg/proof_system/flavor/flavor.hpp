@@ -64,6 +64,8 @@
  */
 
 #pragma once
+#include "barretenberg/common/mem.hpp"
+#include "barretenberg/common/proof_arena.hpp"
 #include "barretenberg/polynomials/barycentric.hpp"
 #include "barretenberg/polynomials/evaluation_domain.hpp"
 #include "barretenberg/polynomials/univariate.hpp"
@@ -136,6 +138,7 @@ class ProvingKey_ : public PrecomputedPolynomials, public WitnessPolynomials {
   public:
     using Polynomial = typename PrecomputedPolynomials::DataType;
     using FF = typename Polynomial::FF;
+    using PrecomputedPolynomialsArray = typename PrecomputedPolynomials::ArrayType;
 
     typename PrecomputedPolynomials::ArrayType& _precomputed_polynomials = PrecomputedPolynomials::_data;
     typename WitnessPolynomials::ArrayType& _witness_polynomials = WitnessPolynomials::_data;
@@ -143,14 +146,14 @@ class ProvingKey_ : public PrecomputedPolynomials, public WitnessPolynomials {
     bool contains_recursive_proof;
     std::vector<uint32_t> recursive_proof_public_input_indices;
     barretenberg::EvaluationDomain<FF> evaluation_domain;
+    // Serves the polynomials of the key and the temporaries of the proofs made from it
+    std::shared_ptr<barretenberg::ProofArena> arena;
 
     ProvingKey_() = default;
     ProvingKey_(const size_t circuit_size, const size_t num_public_inputs)
     {
-        this->evaluation_domain = barretenberg::EvaluationDomain<FF>(circuit_size, circuit_size);
-        PrecomputedPolynomials::circuit_size = circuit_size;
-        this->log_circuit_size = numeric::get_msb(circuit_size);
-        this->num_public_inputs = num_public_inputs;
+        initialise(circuit_size, num_public_inputs, _precomputed_polynomials.size() + _witness_polynomials.size());
+        barretenberg::ProofArena::Scope arena_scope(arena.get());
         // Allocate memory for precomputed polynomials
         for (auto& poly : _precomputed_polynomials) {
             poly = Polynomial(circuit_size);
@@ -160,6 +163,37 @@ class ProvingKey_ : public PrecomputedPolynomials, public WitnessPolynomials {
             poly = Polynomial(circuit_size);
         }
     };
+
+    /**
+     * @brief Construct a key around existing precomputed polynomials (e.g. mapped by read_proving_key_file),
+     * allocating only the witness polynomials
+     */
+    ProvingKey_(const size_t circuit_size,
+                const size_t num_public_inputs,
+                PrecomputedPolynomialsArray&& precomputed_polynomials)
+    {
+        initialise(circuit_size, num_public_inputs, _witness_polynomials.size());
+        _precomputed_polynomials = std::move(precomputed_polynomials);
+        barretenberg::ProofArena::Scope arena_scope(arena.get());
+        for (auto& poly : _witness_polynomials) {
+            poly = Polynomial(circuit_size);
+        }
+    };
+
+  private:
+    void initialise(const size_t circuit_size, const size_t num_public_inputs, const size_t num_allocated_polynomials)
+    {
+        this->evaluation_domain = barretenberg::EvaluationDomain<FF>(circuit_size, circuit_size);
+        PrecomputedPolynomials::circuit_size = circuit_size;
+        this->log_circuit_size = numeric::get_msb(circuit_size);
+        this->num_public_inputs = num_public_inputs;
+        // Let the arena grow up to the polynomials allocated with the key (of one coefficient more than the circuit size
+        // each), and as many as the key holds for the temporaries of the prover, the largest of which are the partial
+        // evaluations of sumcheck and the batched polynomials of the PCS.
+        const size_t polynomial_footprint = pad((circuit_size + 1) * sizeof(FF), barretenberg::ProofArena::ALIGNMENT);
+        const size_t num_polynomials = _precomputed_polynomials.size() + _witness_polynomials.size();
+        arena = barretenberg::ProofArena::create((num_allocated_polynomials + num_polynomials) * polynomial_footprint);
+    }
 };
 
 /**
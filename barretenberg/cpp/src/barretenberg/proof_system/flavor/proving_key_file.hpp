@@ -0,0 +1,58 @@
+#pragma once
+#include "barretenberg/common/serialize.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/polynomials/polynomial_file.hpp"
+#include <memory>
+#include <string>
+
+namespace proof_system::honk::flavor {
+
+/**
+ * @brief Write the precomputed polynomials of a Honk proving key to a polynomial file (see PolynomialFile)
+ */
+template <typename ProvingKey> void write_proving_key_file(const std::string& path, ProvingKey& key)
+{
+    using serialize::write;
+    barretenberg::PolynomialFile file;
+    for (size_t i = 0; i < key._precomputed_polynomials.size(); ++i) {
+        file.add("precomputed_" + std::to_string(i), key._precomputed_polynomials[i]);
+    }
+    std::vector<uint8_t> metadata;
+    write(metadata, static_cast<uint64_t>(key.circuit_size));
+    write(metadata, static_cast<uint64_t>(key.num_public_inputs));
+    write(metadata, key.contains_recursive_proof);
+    write(metadata, key.recursive_proof_public_input_indices);
+    file.set_metadata(std::move(metadata));
+    file.write(path);
+}
+
+/**
+ * @brief Read a proving key written by write_proving_key_file. Its precomputed polynomials are mapped from the file,
+ * without a copy, and only its witness polynomials are allocated.
+ */
+template <typename ProvingKey> std::shared_ptr<ProvingKey> read_proving_key_file(const std::string& path)
+{
+    using serialize::read;
+    using FF = typename ProvingKey::FF;
+    const auto file = barretenberg::PolynomialFile::map(path);
+
+    typename ProvingKey::PrecomputedPolynomialsArray precomputed_polynomials;
+    if (file.get_num_polynomials() != precomputed_polynomials.size()) {
+        throw_or_abort("The proving key file " + path + " is of a different flavor");
+    }
+    for (size_t i = 0; i < precomputed_polynomials.size(); ++i) {
+        precomputed_polynomials[i] = file.template get<FF>("precomputed_" + std::to_string(i));
+    }
+
+    const auto* it = file.get_metadata().data();
+    uint64_t circuit_size = 0;
+    uint64_t num_public_inputs = 0;
+    read(it, circuit_size);
+    read(it, num_public_inputs);
+    auto key = std::make_shared<ProvingKey>(circuit_size, num_public_inputs, std::move(precomputed_polynomials));
+    read(it, key->contains_recursive_proof);
+    read(it, key->recursive_proof_public_input_indices);
+    return key;
+}
+
+} // namespace proof_system::honk::flavor
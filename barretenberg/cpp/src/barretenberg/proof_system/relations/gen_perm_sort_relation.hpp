@@ -15,6 +15,12 @@ template <typename FF_> class GenPermSortRelationImpl {
         6  // range constrain sub-relation 4
     };
 
+    /**
+     * @brief Returns true if the contribution from all subrelations for the provided inputs is identically zero
+     * @details Each of the four range checks is multiplied by q_sort.
+     */
+    template <typename AllEntities> inline static bool skip(const AllEntities& in) { return in.q_sort.is_zero(); }
+
     /**
      * @brief Expression for the generalized permutation sort gate.
      * @details The relation is defined as C(in(X)...) =
@@ -34,6 +34,16 @@ template <typename Relation, size_t subrelation_index> constexpr bool subrelatio
     }
 }
 
+/**
+ * @brief Check whether a relation can tell that its contribution for some inputs is zero, see isSkippable
+ */
+template <typename Relation, typename AllEntities>
+concept isSkippable = requires(const AllEntities& input) {
+                          {
+                              Relation::skip(input)
+                              } -> std::same_as<bool>;
+                      };
+
 /**
  * @brief The templates defined herein facilitate sharing the relation arithmetic between the prover and the verifier.
  *
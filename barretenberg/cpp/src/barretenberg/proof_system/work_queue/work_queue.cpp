@@ -3,6 +3,9 @@
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 
+#include <map>
+#include <vector>
+
 namespace proof_system::plonk {
 
 using namespace barretenberg;
@@ -201,24 +204,68 @@ void work_queue::add_to_queue(const work_item& item)
 
 void work_queue::process_queue()
 {
-    for (const auto& item : work_item_queue) {
-        switch (item.work_type) {
-        // most expensive op
-        case WorkType::SCALAR_MULTIPLICATION: {
+    // Scalar multiplications of equal size are computed together, sharing one pippenger runtime state and a single
+    // batched multi-scalar-multiplication.
+    std::map<size_t, std::vector<size_t>> msm_items_by_size;
+    for (size_t i = 0; i < work_item_queue.size(); ++i) {
+        const auto& item = work_item_queue[i];
+        if (item.work_type == WorkType::SCALAR_MULTIPLICATION) {
             // Note: work_item.constant is an Fr type (see SMALL_FFT), but here it is interpreted simply as a size_t
             auto msm_size = static_cast<size_t>(static_cast<uint256_t>(item.constant));
-
             ASSERT(msm_size <= key->reference_string->get_monomial_size());
+            msm_items_by_size[msm_size].push_back(i);
+        }
+    }
+    std::vector<barretenberg::g1::affine_element> msm_results(work_item_queue.size());
+    for (const auto& [msm_size, item_indices] : msm_items_by_size) {
+        barretenberg::g1::affine_element* srs_points = key->reference_string->get_monomial_points();
+        std::vector<fr*> scalars;
+        for (const size_t i : item_indices) {
+            scalars.push_back(work_item_queue[i].mul_scalars.get());
+        }
 
-            barretenberg::g1::affine_element* srs_points = key->reference_string->get_monomial_points();
-
-            // Run pippenger multi-scalar multiplication.
-            auto runtime_state = barretenberg::scalar_multiplication::pippenger_runtime_state<curve::BN254>(msm_size);
-            barretenberg::g1::affine_element result(barretenberg::scalar_multiplication::pippenger_unsafe<curve::BN254>(
-                item.mul_scalars.get(), srs_points, msm_size, runtime_state));
+        // Run pippenger multi-scalar multiplication.
+        auto runtime_state = barretenberg::scalar_multiplication::pippenger_runtime_state<curve::BN254>(msm_size);
+        auto results = barretenberg::scalar_multiplication::pippenger_batch_unsafe<curve::BN254>(
+            scalars, srs_points, msm_size, runtime_state);
+        for (size_t j = 0; j < item_indices.size(); ++j) {
+            msm_results[item_indices[j]] = barretenberg::g1::affine_element(results[j]);
+        }
+    }
 
-            transcript->add_element(item.tag, result.to_buffer());
+    // The coset FFTs are computed together too, in one batch over the large domain. They read the monomial forms put
+    // in the store by earlier rounds.
+    std::vector<size_t> fft_item_indices;
+    std::vector<barretenberg::polynomial> fft_results;
+    std::vector<fr*> fft_coeffs;
+    for (size_t i = 0; i < work_item_queue.size(); ++i) {
+        if (work_item_queue[i].work_type == WorkType::FFT) {
+            fft_item_indices.push_back(i);
+        }
+    }
+    fft_results.reserve(fft_item_indices.size());
+    for (const size_t i : fft_item_indices) {
+        auto wire = key->polynomial_store.get(work_item_queue[i].tag);
+        fft_results.emplace_back(wire, 4 * key->circuit_size + 4);
+        fft_coeffs.push_back(&fft_results.back()[0]);
+    }
+    if (!fft_coeffs.empty()) {
+        barretenberg::polynomial_arithmetic::coset_fft_many<fr>(fft_coeffs, key->large_domain);
+    }
+    for (size_t j = 0; j < fft_item_indices.size(); ++j) {
+        auto& wire_fft = fft_results[j];
+        for (size_t i = 0; i < 4; i++) {
+            wire_fft[4 * key->circuit_size + i] = wire_fft[i];
+        }
+        key->polynomial_store.put(work_item_queue[fft_item_indices[j]].tag + "_fft", std::move(wire_fft));
+    }
 
+    for (size_t i = 0; i < work_item_queue.size(); ++i) {
+        const auto& item = work_item_queue[i];
+        switch (item.work_type) {
+        // most expensive op, computed above
+        case WorkType::SCALAR_MULTIPLICATION: {
+            transcript->add_element(item.tag, msm_results[i].to_buffer());
             break;
         }
         // Commenting this out as per above.
@@ -248,18 +295,8 @@ void work_queue::process_queue()
         //     }
         //     break;
         // }
+        // computed above
         case WorkType::FFT: {
-            using namespace barretenberg;
-            auto wire = key->polynomial_store.get(item.tag);
-            polynomial wire_fft(wire, 4 * key->circuit_size + 4);
-
-            wire_fft.coset_fft(key->large_domain);
-            for (size_t i = 0; i < 4; i++) {
-                wire_fft[4 * key->circuit_size + i] = wire_fft[i];
-            }
-
-            key->polynomial_store.put(item.tag + "_fft", std::move(wire_fft));
-
             break;
         }
         // 1/4 the cost of an fft (each fft has 1/4 the number of elements)
@@ -1,11 +1,17 @@
 #include "file_crs_factory.hpp"
 #include "../io.hpp"
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/mem.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/bn254/g1.hpp"
 #include "barretenberg/ecc/curves/bn254/pairing.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/ecc/scalar_multiplication/mapped_point_table.hpp"
 #include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include <algorithm>
+#include <cstring>
+#include <memory>
 
 namespace barretenberg::srs::factories {
 
@@ -47,6 +53,95 @@ size_t FileVerifierCrs<curve::Grumpkin>::get_monomial_size() const
     return num_points;
 }
 
+template <typename Curve>
+FileProverCrs<Curve>::FileProverCrs(const size_t num_points, std::string const& path)
+    : num_points(num_points)
+{
+    if (map_point_table_cache(path)) {
+        return;
+    }
+    monomials_ = scalar_multiplication::point_table_alloc<typename Curve::AffineElement>(num_points);
+    srs::IO<Curve>::read_transcript_g1(monomials_.get(), num_points, path);
+    scalar_multiplication::generate_pippenger_point_table<Curve>(monomials_.get(), monomials_.get(), num_points);
+    write_point_table_cache(path);
+}
+
+template <typename Curve>
+FileProverCrs<Curve>::FileProverCrs(const FileProverCrs& smaller, const size_t num_points, std::string const& path)
+    : num_points(num_points)
+{
+    using AffineElement = typename Curve::AffineElement;
+    ASSERT(smaller.num_points <= num_points);
+    if (map_point_table_cache(path)) {
+        return;
+    }
+    const size_t num_new_points = num_points - smaller.num_points;
+    monomials_ = scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    memcpy((void*)monomials_.get(), (void*)smaller.monomials_.get(), smaller.num_points * 2 * sizeof(AffineElement));
+
+    // The new points are read out of place, as the raw points would overlap the expanded points of `smaller`. Only
+    // the tail of the buffer is written, the pages of its head are never touched.
+    std::unique_ptr<AffineElement[], decltype(&aligned_free)> new_points(
+        static_cast<AffineElement*>(aligned_alloc(64, num_points * sizeof(AffineElement))), &aligned_free);
+    srs::IO<Curve>::read_transcript_g1(new_points.get(), num_points, path, smaller.num_points);
+    scalar_multiplication::generate_pippenger_point_table<Curve>(
+        &new_points[smaller.num_points], monomials_.get() + (smaller.num_points * 2), num_new_points);
+    write_point_table_cache(path);
+}
+
+/**
+ * Map the cached point table, if there is one with enough points that was generated from the transcript at `path`.
+ * Only the header of the table, and its fingerprint, are checked, against the first points of the transcript.
+ */
+template <typename Curve> bool FileProverCrs<Curve>::map_point_table_cache(std::string const& path)
+{
+#if !defined(__wasm__)
+    auto table = scalar_multiplication::mapped_point_table<Curve>::try_map(get_point_table_cache_path(path));
+    if (!table.has_value() || table->get_num_points() < num_points) {
+        return false;
+    }
+    const size_t num_fingerprint_points =
+        std::min(table->get_num_points(), scalar_multiplication::POINT_TABLE_FINGERPRINT_POINTS);
+    auto fingerprint_points =
+        scalar_multiplication::point_table_alloc<typename Curve::AffineElement>(num_fingerprint_points);
+    srs::IO<Curve>::read_transcript_g1(fingerprint_points.get(), num_fingerprint_points, path);
+    scalar_multiplication::generate_pippenger_point_table<Curve>(
+        fingerprint_points.get(), fingerprint_points.get(), num_fingerprint_points);
+    if (scalar_multiplication::compute_point_table_fingerprint(fingerprint_points.get(), num_fingerprint_points) ==
+        table->get_fingerprint()) {
+        auto shared_table = std::make_shared<scalar_multiplication::mapped_point_table<Curve>>(std::move(*table));
+        // alias the mapping, so that it lives as long as the points are referenced
+        monomials_ = std::shared_ptr<typename Curve::AffineElement[]>(shared_table, shared_table->get_points());
+        return true;
+    }
+#else
+    static_cast<void>(path);
+#endif
+    return false;
+}
+
+template <typename Curve> void FileProverCrs<Curve>::write_point_table_cache(std::string const& path)
+{
+#if !defined(__wasm__)
+    // the cache is an optimisation, a read-only transcript directory is not an error
+    try {
+        scalar_multiplication::write_point_table<Curve>(get_point_table_cache_path(path), monomials_.get(), num_points);
+    } catch (std::exception const&) {
+    }
+#else
+    static_cast<void>(path);
+#endif
+}
+
+template <typename Curve> std::string FileProverCrs<Curve>::get_point_table_cache_path(std::string const& path)
+{
+    if constexpr (std::same_as<Curve, curve::BN254>) {
+        return path + "/bn254_point_table.dat";
+    } else {
+        return path + "/grumpkin_point_table.dat";
+    }
+}
+
 template <typename Curve>
 FileCrsFactory<Curve>::FileCrsFactory(std::string path, size_t initial_degree)
     : path_(std::move(path))
@@ -56,9 +151,13 @@ FileCrsFactory<Curve>::FileCrsFactory(std::string path, size_t initial_degree)
 template <typename Curve>
 std::shared_ptr<barretenberg::srs::factories::ProverCrs<Curve>> FileCrsFactory<Curve>::get_prover_crs(size_t degree)
 {
-    if (degree != degree_ || !prover_crs_) {
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(mutex_);
+#endif
+    if (!prover_crs_) {
         prover_crs_ = std::make_shared<FileProverCrs<Curve>>(degree, path_);
-        degree_ = degree;
+    } else if (prover_crs_->get_monomial_size() < degree) {
+        prover_crs_ = std::make_shared<FileProverCrs<Curve>>(*prover_crs_, degree, path_);
     }
     return prover_crs_;
 }
@@ -66,6 +165,9 @@ std::shared_ptr<barretenberg::srs::factories::ProverCrs<Curve>> FileCrsFactory<C
 template <typename Curve>
 std::shared_ptr<barretenberg::srs::factories::VerifierCrs<Curve>> FileCrsFactory<Curve>::get_verifier_crs(size_t degree)
 {
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(mutex_);
+#endif
     if (degree != degree_ || !verifier_crs_) {
         verifier_crs_ = std::make_shared<FileVerifierCrs<Curve>>(path_, degree);
         degree_ = degree;
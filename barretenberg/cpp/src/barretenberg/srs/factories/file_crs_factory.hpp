@@ -6,17 +6,24 @@
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "crs_factory.hpp"
 #include <cstddef>
+#ifndef NO_MULTITHREADING
+#include <mutex>
+#endif
 #include <utility>
 
 namespace barretenberg::srs::factories {
 
+template <typename Curve> class FileProverCrs;
+
 /**
  * Create reference strings given a path to a directory of transcript files.
+ *
+ * The prover reference string only grows: a request for a smaller degree is served by the current one, and a request
+ * for a larger degree extends it, reading only the new points. The factory may be used by several threads at once.
  */
 template <typename Curve> class FileCrsFactory : public CrsFactory<Curve> {
   public:
     FileCrsFactory(std::string path, size_t initial_degree = 0);
-    FileCrsFactory(FileCrsFactory&& other) = default;
 
     std::shared_ptr<barretenberg::srs::factories::ProverCrs<Curve>> get_prover_crs(size_t degree) override;
 
@@ -25,26 +32,38 @@ template <typename Curve> class FileCrsFactory : public CrsFactory<Curve> {
   private:
     std::string path_;
     size_t degree_;
-    std::shared_ptr<barretenberg::srs::factories::ProverCrs<Curve>> prover_crs_;
+    std::shared_ptr<FileProverCrs<Curve>> prover_crs_;
     std::shared_ptr<barretenberg::srs::factories::VerifierCrs<Curve>> verifier_crs_;
+#ifndef NO_MULTITHREADING
+    std::mutex mutex_;
+#endif
 };
 
+/**
+ * Prover reference string read from transcript files, as a pippenger point table (see
+ * `generate_pippenger_point_table`).
+ *
+ * Parsing the transcript and computing the endomorphism images dominates the start-up of short-lived provers, so the
+ * expanded table is cached next to the transcript the first time it is computed. Later instances map the cache
+ * read-only, sharing its pages with every other process using the same reference string.
+ */
 template <typename Curve> class FileProverCrs : public ProverCrs<Curve> {
   public:
-    FileProverCrs(const size_t num_points, std::string const& path)
-        : num_points(num_points)
-    {
-        monomials_ = scalar_multiplication::point_table_alloc<typename Curve::AffineElement>(num_points);
-
-        srs::IO<Curve>::read_transcript_g1(monomials_.get(), num_points, path);
-        scalar_multiplication::generate_pippenger_point_table<Curve>(monomials_.get(), monomials_.get(), num_points);
-    };
+    FileProverCrs(const size_t num_points, std::string const& path);
+    // Extends `smaller` to `num_points` points. Its expanded points are copied, only the new points are read and
+    // expanded. `smaller` is left intact, as proving keys may still reference its points.
+    FileProverCrs(const FileProverCrs& smaller, const size_t num_points, std::string const& path);
 
     typename Curve::AffineElement* get_monomial_points() { return monomials_.get(); }
 
     size_t get_monomial_size() const { return num_points; }
 
+    static std::string get_point_table_cache_path(std::string const& path);
+
   private:
+    bool map_point_table_cache(std::string const& path);
+    void write_point_table_cache(std::string const& path);
+
     size_t num_points;
     std::shared_ptr<typename Curve::AffineElement[]> monomials_;
 };
@@ -1,11 +1,14 @@
 #pragma once
 #include "../ecc/curves/bn254/bn254.hpp"
 #include "../ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/common/thread.hpp"
+#include <algorithm>
 #include <concepts>
 #include <cstdint>
 #include <fstream>
 #include <string>
 #include <sys/stat.h>
+#include <vector>
 
 namespace barretenberg::srs {
 /**
@@ -64,6 +67,8 @@ template <typename Curve> class IO {
     using AffineElement = typename Curve::AffineElement;
 
     static constexpr size_t BLAKE2B_CHECKSUM_LENGTH = 64;
+    // Transcript points are read and converted in parallel, in blocks of this many points.
+    static constexpr size_t POINTS_PER_READ_BLOCK = 1UL << 16;
 
     static size_t get_transcript_size(const Manifest& manifest)
     {
@@ -275,12 +280,31 @@ template <typename Curve> class IO {
     template <typename AffineElementType>
     static void read_affine_elements_from_buffer(AffineElementType* elements, char const* buffer, size_t buffer_size)
     {
-        memcpy((void*)elements, (void*)buffer, buffer_size);
-        byteswap<>(elements, buffer_size);
+        constexpr size_t block_size = POINTS_PER_READ_BLOCK * sizeof(AffineElementType);
+        parallel_for((buffer_size + block_size - 1) / block_size, [&](size_t i) {
+            const size_t offset = i * block_size;
+            const size_t size = std::min(block_size, buffer_size - offset);
+            memcpy((void*)((char*)elements + offset), (void*)(buffer + offset), size);
+            byteswap<>((AffineElementType*)((char*)elements + offset), size);
+        });
     }
 
-    static void read_transcript_g1(AffineElement* monomials, size_t degree, std::string const& dir)
+    /**
+     * @brief Read the g1 points [start, degree) of the transcript in `dir` into `monomials[start, degree)`.
+     *
+     * The manifests are read first, to locate every point and check the files are large enough. The points are then
+     * read and converted to montgomery form in parallel, in blocks that each open their own handle to the file.
+     */
+    static void read_transcript_g1(AffineElement* monomials, size_t degree, std::string const& dir, size_t start = 0)
     {
+        struct ReadBlock {
+            std::string path;
+            size_t file_offset;
+            size_t first_point;
+            size_t num_points;
+        };
+        std::vector<ReadBlock> blocks;
+
         size_t num = 0;
         size_t num_read = 0;
         std::string path = get_transcript_path(dir, num);
@@ -289,17 +313,23 @@ template <typename Curve> class IO {
             Manifest manifest;
             read_manifest(path, manifest);
 
-            auto offset = sizeof(Manifest);
             const size_t num_to_read = std::min((size_t)manifest.num_g1_points, degree - num_read);
             const size_t g1_buffer_size = sizeof(Fq) * 2 * num_to_read;
+            const size_t file_size = get_file_size(path);
+            if (file_size < sizeof(Manifest) + g1_buffer_size) {
+                throw_or_abort(format("Only read ",
+                                      file_size > sizeof(Manifest) ? file_size - sizeof(Manifest) : 0,
+                                      " bytes from file but expected ",
+                                      g1_buffer_size,
+                                      "."));
+            }
 
-            char* buffer = (char*)&monomials[num_read];
-            size_t size = 0;
-
-            // We must pass the size actually read to the second call, not the desired
-            // g1_buffer_size as the file may have been smaller than this.
-            read_file_into_buffer(buffer, size, path, offset, g1_buffer_size);
-            srs::IO<Curve>::byteswap(&monomials[num_read], size);
+            for (size_t i = std::max(num_read, start); i < num_read + num_to_read; i += POINTS_PER_READ_BLOCK) {
+                blocks.push_back({ path,
+                                   sizeof(Manifest) + sizeof(Fq) * 2 * (i - num_read),
+                                   i,
+                                   std::min(POINTS_PER_READ_BLOCK, num_read + num_to_read - i) });
+            }
 
             num_read += num_to_read;
             path = get_transcript_path(dir, ++num);
@@ -319,6 +349,14 @@ template <typename Curve> class IO {
                        "by editing `srs_db/download_ignition.sh` (but be careful, as this suggests you've "
                        "just changed a circuit to exceed a new 'power of two' boundary)."));
         }
+
+        parallel_for(blocks.size(), [&](size_t i) {
+            const ReadBlock& block = blocks[i];
+            char* buffer = (char*)&monomials[block.first_point];
+            size_t size = 0;
+            read_file_into_buffer(buffer, size, block.path, block.file_offset, sizeof(Fq) * 2 * block.num_points);
+            srs::IO<Curve>::byteswap(&monomials[block.first_point], size);
+        });
     }
 
     static void read_transcript_g2(auto& g2_x, std::string const& dir)
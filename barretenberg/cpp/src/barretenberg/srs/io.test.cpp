@@ -2,6 +2,11 @@
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/ecc/curves/bn254/fq12.hpp"
 #include "barretenberg/ecc/curves/bn254/pairing.hpp"
+#include "barretenberg/ecc/scalar_multiplication/mapped_point_table.hpp"
+#include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/srs/factories/file_crs_factory.hpp"
+#include <filesystem>
 #include <gtest/gtest.h>
 
 using namespace barretenberg;
@@ -30,3 +35,95 @@ TEST(io, read_transcript_loads_well_formed_srs)
     }
     aligned_free(monomials);
 }
+
+namespace {
+/**
+ * A transcript directory of its own, linking to the transcript of ../srs_db/ignition, so that the point table cache
+ * written to it is neither read from nor removed under other tests.
+ */
+class TemporaryTranscript {
+  public:
+    explicit TemporaryTranscript(std::string const& name)
+        : path((std::filesystem::temp_directory_path() / name).string())
+    {
+        std::filesystem::remove_all(path);
+        std::filesystem::create_directories(path);
+        std::filesystem::create_directory_symlink(std::filesystem::absolute("../srs_db/ignition/monomial"),
+                                                  std::filesystem::path(path) / "monomial");
+    }
+    TemporaryTranscript(const TemporaryTranscript&) = delete;
+    TemporaryTranscript& operator=(const TemporaryTranscript&) = delete;
+    ~TemporaryTranscript() { std::filesystem::remove_all(path); }
+
+    const std::string path;
+};
+} // namespace
+
+TEST(io, file_prover_crs_caches_point_table)
+{
+    using FileProverCrs = srs::factories::FileProverCrs<curve::BN254>;
+    TemporaryTranscript transcript("bb_io_test_caches_point_table");
+    const std::string& path = transcript.path;
+    const std::string cache_path = FileProverCrs::get_point_table_cache_path(path);
+
+    size_t degree = 1024;
+    FileProverCrs computed_crs(degree, path);
+    EXPECT_TRUE(std::filesystem::exists(cache_path));
+
+    // a smaller reference string is served from the cache of a larger one
+    FileProverCrs cached_crs(degree / 2, path);
+    for (size_t i = 0; i < degree; ++i) {
+        EXPECT_EQ(computed_crs.get_monomial_points()[i], cached_crs.get_monomial_points()[i]);
+    }
+}
+
+TEST(io, file_crs_factory_grows_prover_crs)
+{
+    using FileProverCrs = srs::factories::FileProverCrs<curve::BN254>;
+    TemporaryTranscript transcript("bb_io_test_grows_prover_crs");
+    const std::string& path = transcript.path;
+    const std::string cache_path = FileProverCrs::get_point_table_cache_path(path);
+
+    size_t degree = 1024;
+    srs::factories::FileCrsFactory<curve::BN254> factory(path);
+    auto small_crs = factory.get_prover_crs(degree / 2);
+    std::filesystem::remove(cache_path);
+
+    // the larger reference string extends the smaller one, which stays valid for whoever holds it
+    auto grown_crs = factory.get_prover_crs(degree);
+    EXPECT_EQ(grown_crs->get_monomial_size(), degree);
+    EXPECT_EQ(factory.get_prover_crs(degree / 2), grown_crs);
+    std::filesystem::remove(cache_path);
+
+    FileProverCrs computed_crs(degree, path);
+    for (size_t i = 0; i < degree * 2; ++i) {
+        EXPECT_EQ(computed_crs.get_monomial_points()[i], grown_crs->get_monomial_points()[i]);
+    }
+    for (size_t i = 0; i < degree; ++i) {
+        EXPECT_EQ(computed_crs.get_monomial_points()[i], small_crs->get_monomial_points()[i]);
+    }
+}
+
+// A cached table generated from another reference string is recomputed rather than mapped.
+TEST(io, file_prover_crs_ignores_point_table_of_another_srs)
+{
+    using FileProverCrs = srs::factories::FileProverCrs<curve::BN254>;
+    TemporaryTranscript transcript("bb_io_test_ignores_point_table");
+    const std::string& path = transcript.path;
+
+    size_t degree = 1024;
+    auto points = scalar_multiplication::point_table_alloc<g1::affine_element>(degree);
+    for (size_t i = 0; i < degree; ++i) {
+        points.get()[i] = g1::affine_element(g1::element::random_element());
+    }
+    scalar_multiplication::generate_pippenger_point_table<curve::BN254>(points.get(), points.get(), degree);
+    scalar_multiplication::write_point_table<curve::BN254>(
+        FileProverCrs::get_point_table_cache_path(path), points.get(), degree);
+
+    FileProverCrs crs(degree, path);
+    auto monomials = scalar_multiplication::point_table_alloc<g1::affine_element>(degree);
+    srs::IO<curve::BN254>::read_transcript_g1(monomials.get(), degree, "../srs_db/ignition");
+    for (size_t i = 0; i < degree; ++i) {
+        EXPECT_EQ(crs.get_monomial_points()[2 * i], monomials.get()[i]);
+    }
+}
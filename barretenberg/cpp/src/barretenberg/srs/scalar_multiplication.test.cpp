@@ -12,12 +12,17 @@
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/test.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/scalar_multiplication/mapped_point_table.hpp"
+#include "barretenberg/ecc/scalar_multiplication/msm_profile.hpp"
 #include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
 #include "barretenberg/srs/factories/file_crs_factory.hpp"
 #include "barretenberg/srs/io.hpp"
 
 #include <cstddef>
+#include <filesystem>
+#include <fstream>
 #include <vector>
 
 namespace {
@@ -1057,3 +1062,241 @@ TYPED_TEST(ScalarMultiplicationTests, PippengerMulByZero)
 
     EXPECT_EQ(result.is_point_at_infinity(), true);
 }
+
+TYPED_TEST(ScalarMultiplicationTests, PippengerBatch)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    // not a power of two, and more msms than fit in one batch tile
+    constexpr size_t num_points = 1000;
+    constexpr size_t batch_size = barretenberg::scalar_multiplication::MAX_PIPPENGER_BATCH_SIZE + 2;
+
+    auto points = barretenberg::scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    for (std::ptrdiff_t i = 0; i < (std::ptrdiff_t)num_points; ++i) {
+        points[i] = AffineElement(Element::random_element());
+    }
+    std::vector<std::vector<Fr>> scalars(batch_size, std::vector<Fr>(num_points));
+    std::vector<Fr*> scalar_ptrs;
+    for (auto& msm_scalars : scalars) {
+        for (auto& scalar : msm_scalars) {
+            scalar = Fr::random_element();
+        }
+        scalar_ptrs.push_back(msm_scalars.data());
+    }
+    // exercise the zero and skew-free paths in one of the msms
+    for (size_t i = 0; i < num_points; i += 3) {
+        scalars[1][i] = Fr::zero();
+    }
+
+    std::vector<Element> expected(batch_size);
+    for (size_t k = 0; k < batch_size; ++k) {
+        expected[k].self_set_infinity();
+        for (size_t i = 0; i < num_points; ++i) {
+            expected[k] += points[(std::ptrdiff_t)i] * scalars[k][i];
+        }
+        expected[k] = expected[k].normalize();
+    }
+    barretenberg::scalar_multiplication::generate_pippenger_point_table<Curve>(points.get(), points.get(), num_points);
+
+    barretenberg::scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+    std::vector<Element> results = barretenberg::scalar_multiplication::pippenger_batch_unsafe<Curve>(
+        scalar_ptrs, points.get(), num_points, state);
+
+    ASSERT_EQ(results.size(), batch_size);
+    for (size_t k = 0; k < batch_size; ++k) {
+        EXPECT_EQ(results[k].normalize(), expected[k]);
+    }
+}
+
+TYPED_TEST(ScalarMultiplicationTests, PippengerTunedProfile)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+    using barretenberg::scalar_multiplication::msm_profile;
+
+    // not a power of two, so pippenger runs over several slices with differently tuned parameters
+    constexpr size_t num_points = 1000;
+
+    auto points = barretenberg::scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    for (std::ptrdiff_t i = 0; i < (std::ptrdiff_t)num_points; ++i) {
+        points[i] = AffineElement(Element::random_element());
+    }
+    std::vector<std::vector<Fr>> scalars(2, std::vector<Fr>(num_points));
+    std::vector<Fr*> scalar_ptrs;
+    for (auto& msm_scalars : scalars) {
+        for (auto& scalar : msm_scalars) {
+            scalar = Fr::random_element();
+        }
+        scalar_ptrs.push_back(msm_scalars.data());
+    }
+    std::vector<Element> expected(scalars.size());
+    for (size_t k = 0; k < scalars.size(); ++k) {
+        expected[k].self_set_infinity();
+        for (size_t i = 0; i < num_points; ++i) {
+            expected[k] += points[(std::ptrdiff_t)i] * scalars[k][i];
+        }
+        expected[k] = expected[k].normalize();
+    }
+    barretenberg::scalar_multiplication::generate_pippenger_point_table<Curve>(points.get(), points.get(), num_points);
+
+    // widths that are not monotone in the number of points, and rounds split over fewer threads than cpus
+    msm_profile profile;
+    profile.num_cpus = static_cast<uint32_t>(get_num_cpus());
+    profile.bucket_widths[9] = 3;
+    profile.bucket_widths[8] = 10;
+    profile.bucket_widths[7] = 2;
+    profile.bucket_widths[6] = 8;
+    profile.num_threads[9] = 1;
+    profile.num_threads[8] = static_cast<uint32_t>(std::min(get_num_cpus_pow2(), size_t(2)));
+
+    // the profile must survive a round trip through its file format
+    const auto profile_path = (std::filesystem::temp_directory_path() / "bb_msm_profile_test").string();
+    barretenberg::scalar_multiplication::write_msm_profile(profile, profile_path);
+    const auto read_profile = barretenberg::scalar_multiplication::read_msm_profile(profile_path);
+    std::filesystem::remove(profile_path);
+    ASSERT_TRUE(read_profile.has_value());
+    EXPECT_EQ(*read_profile, profile);
+
+    const msm_profile original_profile = barretenberg::scalar_multiplication::get_msm_profile();
+    barretenberg::scalar_multiplication::set_msm_profile(profile);
+    {
+        barretenberg::scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+        Element result = barretenberg::scalar_multiplication::pippenger<Curve>(
+            scalar_ptrs[0], points.get(), num_points, state);
+        EXPECT_EQ(result.normalize(), expected[0]);
+
+        std::vector<Element> results = barretenberg::scalar_multiplication::pippenger_batch_unsafe<Curve>(
+            scalar_ptrs, points.get(), num_points, state);
+        for (size_t k = 0; k < scalars.size(); ++k) {
+            EXPECT_EQ(results[k].normalize(), expected[k]);
+        }
+    }
+    barretenberg::scalar_multiplication::set_msm_profile(original_profile);
+}
+
+TYPED_TEST(ScalarMultiplicationTests, PippengerStreaming)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    // more points than the msm, and an msm that is not a multiple of the chunk size
+    constexpr size_t num_table_points = 1100;
+    constexpr size_t num_points = 1000;
+    constexpr size_t chunk_size = 300;
+
+    auto points = barretenberg::scalar_multiplication::point_table_alloc<AffineElement>(num_table_points);
+    for (std::ptrdiff_t i = 0; i < (std::ptrdiff_t)num_table_points; ++i) {
+        points[i] = AffineElement(Element::random_element());
+    }
+    std::vector<Fr> scalars(num_points);
+    for (auto& scalar : scalars) {
+        scalar = Fr::random_element();
+    }
+    Element expected;
+    expected.self_set_infinity();
+    for (size_t i = 0; i < num_points; ++i) {
+        expected += points[(std::ptrdiff_t)i] * scalars[i];
+    }
+    expected = expected.normalize();
+    barretenberg::scalar_multiplication::generate_pippenger_point_table<Curve>(
+        points.get(), points.get(), num_table_points);
+
+    const auto table_path = (std::filesystem::temp_directory_path() / "bb_point_table_test").string();
+    barretenberg::scalar_multiplication::write_point_table<Curve>(table_path, points.get(), num_table_points);
+    {
+        barretenberg::scalar_multiplication::mapped_point_table<Curve> table(table_path);
+        EXPECT_EQ(table.get_num_points(), num_table_points);
+
+        Element result = barretenberg::scalar_multiplication::pippenger_streaming<Curve>(
+            &scalars[0], table, num_points, chunk_size);
+        EXPECT_EQ(result.normalize(), expected);
+
+        // the released pages are faulted back in on a second pass
+        result = barretenberg::scalar_multiplication::pippenger_streaming<Curve>(&scalars[0], table, num_points);
+        EXPECT_EQ(result.normalize(), expected);
+    }
+
+    auto corrupt = [&](size_t offset) {
+        std::fstream file(table_path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(static_cast<std::streamoff>(barretenberg::scalar_multiplication::POINT_TABLE_HEADER_SIZE + offset));
+        file.put(0x55);
+    };
+    // a table corrupted past its fingerprint fails its checksum, which is only checked if asked for
+    corrupt(barretenberg::scalar_multiplication::POINT_TABLE_FINGERPRINT_POINTS * 2 * sizeof(AffineElement) + 100);
+    EXPECT_TRUE(barretenberg::scalar_multiplication::mapped_point_table<Curve>::try_map(table_path).has_value());
+    EXPECT_FALSE(
+        barretenberg::scalar_multiplication::mapped_point_table<Curve>::try_map(table_path, true).has_value());
+    // a table corrupted in its fingerprint fails to map
+    corrupt(100);
+    EXPECT_FALSE(barretenberg::scalar_multiplication::mapped_point_table<Curve>::try_map(table_path).has_value());
+    std::filesystem::remove(table_path);
+}
+
+TYPED_TEST(ScalarMultiplicationTests, PippengerSparseScalars)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    // selector-like distribution: mostly zero and one, some small integers and a few full-width scalars
+    constexpr size_t num_points = 1001;
+
+    auto points = barretenberg::scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    for (std::ptrdiff_t i = 0; i < (std::ptrdiff_t)num_points; ++i) {
+        points[i] = AffineElement(Element::random_element());
+    }
+    std::vector<Fr> scalars(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        switch (engine.get_random_uint32() & 7) {
+        case 0:
+            scalars[i] = Fr::random_element();
+            break;
+        case 1:
+            scalars[i] = Fr(engine.get_random_uint64());
+            break;
+        case 2:
+        case 3:
+            scalars[i] = Fr::one();
+            break;
+        default:
+            scalars[i] = Fr::zero();
+        }
+    }
+
+    Element expected;
+    expected.self_set_infinity();
+    for (size_t i = 0; i < num_points; ++i) {
+        expected += points[(std::ptrdiff_t)i] * scalars[i];
+    }
+    expected = expected.normalize();
+    barretenberg::scalar_multiplication::generate_pippenger_point_table<Curve>(points.get(), points.get(), num_points);
+
+    barretenberg::scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+    Element result = barretenberg::scalar_multiplication::pippenger<Curve>(&scalars[0], points.get(), num_points, state);
+    EXPECT_EQ(result.normalize(), expected);
+
+    Element unsafe_result =
+        barretenberg::scalar_multiplication::pippenger_unsafe<Curve>(&scalars[0], points.get(), num_points, state);
+    EXPECT_EQ(unsafe_result.normalize(), expected);
+
+    Element dense_result =
+        barretenberg::scalar_multiplication::pippenger_dense<Curve>(&scalars[0], points.get(), num_points, state);
+    EXPECT_EQ(dense_result.normalize(), expected);
+
+    // too few zero scalars for the sparse path, but too many to rule it out without classifying every scalar
+    expected.self_set_infinity();
+    for (size_t i = 0; i < num_points; ++i) {
+        scalars[i] = (i % 10 == 0) ? Fr::zero() : Fr::random_element();
+        expected += Element(points[(std::ptrdiff_t)i * 2]) * scalars[i];
+    }
+    result = barretenberg::scalar_multiplication::pippenger<Curve>(&scalars[0], points.get(), num_points, state);
+    EXPECT_EQ(result.normalize(), expected.normalize());
+}